@@ -5,27 +5,48 @@ using UnityEngine;
 public class Coin : MonoBehaviour
 {
     [SerializeField] float CoinTurnSpeed = 90f; 
+    //slot in CoinAnimationSystem while active
+    [System.NonSerialized] public int animationIndex = -1;
+    //set by the pool that made this coin, null for coins placed in a scene
+    [System.NonSerialized] public PooledObject pooled;
+
+    void OnEnable()
+    {
+        CoinAnimationSystem.Register(this, CoinTurnSpeed);
+    }
+
+    void OnDisable()
+    {
+        CoinAnimationSystem.Unregister(this);
+    }
 
     void OnTriggerEnter(Collider other)
     {
-        if(other.gameObject.GetComponent<Obstacle>() != null)
+        GameplayCounters.TriggerCallbacks++;
+        //check if object is player
+        if(other.gameObject.layer != EntityLayers.Player)
         {
-            Destroy(gameObject);
             return;
         }
-        //check if object is player
-        if(other.gameObject.name != "Player")
+        Collect();
+    }
+
+    //also called by the player's high-speed sweep when it passes through the coin between steps
+    public void Collect()
+    {
+        if (!gameObject.activeSelf)
         {
             return;
         }
+        GameplayCounters.CoinsCollected++;
         //player score
         GameManager.inst.IncrementScore();
-        //destroy coin
-        Destroy(gameObject);
-    }
-    // Update is called once per frame
-    void Update()
-    {
-        transform.Rotate(0,0,CoinTurnSpeed * Time.deltaTime);
+        //return coin to its pool
+        if (pooled != null)
+        {
+            pooled.Despawn();
+            return;
+        }
+        ObjectPools.Despawn(gameObject);
     }
 }
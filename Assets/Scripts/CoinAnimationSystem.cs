@@ -0,0 +1,109 @@
+using System.Collections.Generic;
+using Unity.Jobs;
+using UnityEngine;
+using UnityEngine.Jobs;
+
+//spins every active coin in one transform job instead of one Update per coin
+public class CoinAnimationSystem : MonoBehaviour
+{
+    static CoinAnimationSystem inst;
+    TransformAccessArray transforms;
+    readonly List<Coin> coins = new List<Coin>();
+    JobHandle handle;
+    //all coins come from the same prefab, so they share one turn speed
+    float turnSpeed;
+
+    struct SpinJob : IJobParallelForTransform
+    {
+        public Quaternion delta;
+
+        public void Execute(int index, TransformAccess transform)
+        {
+            transform.localRotation = transform.localRotation * delta;
+        }
+    }
+
+    public static int Count => inst == null ? 0 : inst.coins.Count;
+
+    public static void Register(Coin coin, float turnSpeed)
+    {
+        if (inst == null)
+        {
+            inst = new GameObject("CoinAnimationSystem").AddComponent<CoinAnimationSystem>();
+        }
+        inst.Add(coin, turnSpeed);
+    }
+
+    //wait for this frame's spin before coin transforms are moved from the main thread
+    public static void Complete()
+    {
+        if (inst != null)
+        {
+            inst.handle.Complete();
+        }
+    }
+
+    public static void Unregister(Coin coin)
+    {
+        if (inst != null)
+        {
+            inst.Remove(coin);
+        }
+    }
+
+    void Awake()
+    {
+        transforms = new TransformAccessArray(64);
+    }
+
+    void Add(Coin coin, float speed)
+    {
+        handle.Complete();
+        turnSpeed = speed;
+        coin.animationIndex = coins.Count;
+        coins.Add(coin);
+        transforms.Add(coin.transform);
+    }
+
+    void Remove(Coin coin)
+    {
+        int index = coin.animationIndex;
+        if (index < 0)
+        {
+            return;
+        }
+        handle.Complete();
+        int last = coins.Count - 1;
+        coins[index] = coins[last];
+        coins[index].animationIndex = index;
+        coins.RemoveAt(last);
+        transforms.RemoveAtSwapBack(index);
+        coin.animationIndex = -1;
+    }
+
+    void Update()
+    {
+        if (coins.Count == 0)
+        {
+            return;
+        }
+        var job = new SpinJob { delta = Quaternion.Euler(0, 0, turnSpeed * Time.deltaTime) };
+        handle = job.Schedule(transforms);
+        JobHandle.ScheduleBatchedJobs();
+    }
+
+    void LateUpdate()
+    {
+        handle.Complete();
+    }
+
+    void OnDestroy()
+    {
+        handle.Complete();
+        transforms.Dispose();
+        if (inst == this)
+        {
+            inst = null;
+        }
+    }
+}
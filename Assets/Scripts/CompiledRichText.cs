@@ -0,0 +1,88 @@
+using TMPro;
+using UnityEngine;
+
+//TMP label for templated markup that is shown again and again, like coloured banners
+//colour-only markup is compiled once through RichTextCache, set as plain text with rich text off so TMP skips
+//tag parsing, and the colours are written into the vertex colours after each rebuild
+//markup RichTextCache cannot compile goes to TMP unchanged
+[RequireComponent(typeof(TMP_Text))]
+public class CompiledRichText : MonoBehaviour
+{
+    [SerializeField] TMP_Text text;
+    string current;
+    RichTextCache.Compiled compiled;
+
+    public TMP_Text Text => text;
+    public int Skipped { get; private set; }
+
+    void Awake()
+    {
+        if (text == null)
+        {
+            text = GetComponent<TMP_Text>();
+        }
+    }
+
+    void OnEnable()
+    {
+        TMPro_EventManager.TEXT_CHANGED_EVENT.Add(OnTextChanged);
+    }
+
+    void OnDisable()
+    {
+        TMPro_EventManager.TEXT_CHANGED_EVENT.Remove(OnTextChanged);
+    }
+
+    public void SetText(string markup)
+    {
+        //TMP rebuilds on every SetText, even for the string it already shows
+        if (markup == current)
+        {
+            Skipped++;
+            return;
+        }
+        current = markup;
+        compiled = RichTextCache.Get(markup);
+        if (compiled.plain == null)
+        {
+            text.richText = true;
+            text.SetText(markup);
+            return;
+        }
+        text.richText = false;
+        text.SetText(compiled.plain);
+    }
+
+    void OnTextChanged(Object changed)
+    {
+        if (changed != text || compiled == null || compiled.plain == null || compiled.runs.Length == 0)
+        {
+            return;
+        }
+        TMP_TextInfo info = text.textInfo;
+        Color32 label = text.color;
+        for (int r = 0; r < compiled.runs.Length; r++)
+        {
+            RichTextCache.ColorRun run = compiled.runs[r];
+            Color32 color = run.labelColor ? new Color32(label.r, label.g, label.b, run.color.a) : run.color;
+            //TMP takes the lower of the tag alpha and the label alpha
+            color.a = color.a < label.a ? color.a : label.a;
+            int end = Mathf.Min(run.start + run.length, info.characterCount);
+            for (int i = run.start; i < end; i++)
+            {
+                TMP_CharacterInfo charInfo = info.characterInfo[i];
+                if (!charInfo.isVisible)
+                {
+                    continue;
+                }
+                Color32[] colors = info.meshInfo[charInfo.materialReferenceIndex].colors32;
+                int v = charInfo.vertexIndex;
+                colors[v] = color;
+                colors[v + 1] = color;
+                colors[v + 2] = color;
+                colors[v + 3] = color;
+            }
+        }
+        text.UpdateVertexData(TMP_VertexDataUpdateFlags.Colors32);
+    }
+}
@@ -0,0 +1,9 @@
+//physics layers from ProjectSettings/TagManager, the layer index doubles as the entity kind
+//coins only collide with the player in the layer collision matrix, so PhysX drops every other coin pair
+public static class EntityLayers
+{
+    public const int Ground = 6;
+    public const int Player = 7;
+    public const int Coin = 8;
+    public const int Obstacle = 9;
+}
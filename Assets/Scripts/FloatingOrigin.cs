@@ -0,0 +1,102 @@
+using System.Collections.Generic;
+using System.Diagnostics;
+using UnityEngine;
+
+//anything holding world positions that must move when the origin is shifted
+public interface IOriginShift
+{
+    void ShiftOrigin(Vector3 offset);
+}
+
+//keeps the run near the world origin by shifting everything back along z once the player gets too far out
+public class FloatingOrigin : MonoBehaviour
+{
+    //distance from the origin that triggers a shift
+    [SerializeField] float threshold = 1000f;
+    //shifts are rounded to whole tiles so tile positions stay exact, GroundSpawner sets it to its tile length
+    [SerializeField] float snap = 10f;
+    [SerializeField] float budgetMs = 2f;
+    [SerializeField] Transform focus;
+    readonly List<IOriginShift> listeners = new List<IOriginShift>();
+
+    public int Shifts { get; private set; }
+    //total distance moved back, add to a position to get its distance from the start line
+    public Vector3 TotalOffset { get; private set; }
+    public double LastShiftMs { get; private set; }
+    public double MaxShiftMs { get; private set; }
+    public int OverBudget { get; private set; }
+    public float Snap
+    {
+        get { return snap; }
+        set { snap = value; }
+    }
+
+    private void Awake()
+    {
+        Services.Register(this);
+    }
+
+    private void OnDestroy()
+    {
+        Services.Unregister(this);
+    }
+
+    private void Start()
+    {
+        if (focus == null)
+        {
+            focus = Services.Get<SwerveMovement>().transform;
+        }
+    }
+
+    public void Add(IOriginShift listener)
+    {
+        listeners.Add(listener);
+    }
+
+    public void Remove(IOriginShift listener)
+    {
+        listeners.Remove(listener);
+    }
+
+    //a restart puts everything back at its unshifted start positions
+    public void ResetOffset()
+    {
+        TotalOffset = Vector3.zero;
+    }
+
+    private void LateUpdate()
+    {
+        float z = focus.position.z;
+        if (Mathf.Abs(z) < threshold)
+        {
+            return;
+        }
+        Shift(new Vector3(0, 0, -Mathf.Round(z / snap) * snap));
+    }
+
+    //moves every listener in one pass and resyncs physics once at the end
+    public void Shift(Vector3 offset)
+    {
+        long start = Stopwatch.GetTimestamp();
+        CoinAnimationSystem.Complete();
+        for (int i = 0; i < listeners.Count; i++)
+        {
+            listeners[i].ShiftOrigin(offset);
+        }
+        Physics.SyncTransforms();
+        TotalOffset -= offset;
+        Shifts++;
+        double ms = (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+        LastShiftMs = ms;
+        if (ms > MaxShiftMs)
+        {
+            MaxShiftMs = ms;
+        }
+        if (ms > budgetMs)
+        {
+            OverBudget++;
+            UnityEngine.Debug.LogWarning("FloatingOrigin: shift took " + ms.ToString("F2") + " ms, budget is " + budgetMs + " ms");
+        }
+    }
+}
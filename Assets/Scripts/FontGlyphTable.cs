@@ -0,0 +1,93 @@
+using System.Collections.Generic;
+using TMPro;
+
+//character lookup for a TMP font asset without hashing on the common path
+//U+0000-U+00FF index straight into an array, everything else is a binary search over sorted code points
+//rebuilt when the font's character table grows, e.g. after TryAddCharacters on a dynamic font
+public class FontGlyphTable
+{
+    const int directRange = 256;
+    static readonly Dictionary<TMP_FontAsset, FontGlyphTable> tables = new Dictionary<TMP_FontAsset, FontGlyphTable>();
+
+    readonly TMP_FontAsset font;
+    readonly TMP_Character[] direct = new TMP_Character[directRange];
+    uint[] codes = new uint[0];
+    TMP_Character[] characters = new TMP_Character[0];
+    int builtFrom = -1;
+
+    public static int Builds { get; private set; }
+
+    FontGlyphTable(TMP_FontAsset font)
+    {
+        this.font = font;
+    }
+
+    public static FontGlyphTable For(TMP_FontAsset font)
+    {
+        FontGlyphTable table;
+        if (!tables.TryGetValue(font, out table))
+        {
+            table = new FontGlyphTable(font);
+            tables.Add(font, table);
+        }
+        return table;
+    }
+
+    //force a rebuild, for when the font's data was cleared and refilled to the same size
+    public static void Invalidate(TMP_FontAsset font)
+    {
+        FontGlyphTable table;
+        if (tables.TryGetValue(font, out table))
+        {
+            table.builtFrom = -1;
+        }
+    }
+
+    public bool TryGet(uint unicode, out TMP_Character character)
+    {
+        if (builtFrom != font.characterTable.Count)
+        {
+            Build();
+        }
+        if (unicode < directRange)
+        {
+            character = direct[unicode];
+            return character != null;
+        }
+        int index = System.Array.BinarySearch(codes, unicode);
+        character = index >= 0 ? characters[index] : null;
+        return character != null;
+    }
+
+    void Build()
+    {
+        List<TMP_Character> table = font.characterTable;
+        System.Array.Clear(direct, 0, directRange);
+        int extended = 0;
+        for (int i = 0; i < table.Count; i++)
+        {
+            if (table[i].unicode >= directRange)
+            {
+                extended++;
+            }
+        }
+        codes = new uint[extended];
+        characters = new TMP_Character[extended];
+        extended = 0;
+        for (int i = 0; i < table.Count; i++)
+        {
+            TMP_Character character = table[i];
+            if (character.unicode < directRange)
+            {
+                direct[character.unicode] = character;
+                continue;
+            }
+            codes[extended] = character.unicode;
+            characters[extended] = character;
+            extended++;
+        }
+        System.Array.Sort(codes, characters);
+        builtFrom = table.Count;
+        Builds++;
+    }
+}
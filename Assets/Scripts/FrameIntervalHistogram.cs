@@ -0,0 +1,88 @@
+using System;
+
+//fixed-bucket histogram of frame intervals in milliseconds
+public class FrameIntervalHistogram
+{
+    public const double BucketMs = 0.1;
+    readonly int[] buckets;
+    int count;
+    double mean;
+    double m2;
+    double max;
+
+    public FrameIntervalHistogram(double rangeMs = 100)
+    {
+        //last bucket collects everything above rangeMs
+        buckets = new int[(int)(rangeMs / BucketMs) + 1];
+    }
+
+    public int Count => count;
+    public double Mean => mean;
+    public double Max => max;
+    //standard deviation of the interval
+    public double Jitter => count > 1 ? Math.Sqrt(m2 / (count - 1)) : 0;
+    public double P50 => Percentile(0.50);
+    public double P95 => Percentile(0.95);
+    public double P99 => Percentile(0.99);
+
+    public void Add(double ms)
+    {
+        int bucket = (int)(ms / BucketMs);
+        buckets[Math.Min(Math.Max(bucket, 0), buckets.Length - 1)]++;
+        count++;
+        double delta = ms - mean;
+        mean += delta / count;
+        m2 += delta * (ms - mean);
+        if (ms > max)
+        {
+            max = ms;
+        }
+    }
+
+    //upper edge of the bucket holding the given fraction of samples
+    public double Percentile(double fraction)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+        int target = (int)Math.Ceiling(count * fraction);
+        int seen = 0;
+        for (int i = 0; i < buckets.Length; i++)
+        {
+            seen += buckets[i];
+            if (seen >= target)
+            {
+                return i == buckets.Length - 1 ? max : (i + 1) * BucketMs;
+            }
+        }
+        return max;
+    }
+
+    //sample count per BucketMs-wide bucket, trimmed after the last non-empty one
+    public int[] ToArray()
+    {
+        int length = buckets.Length;
+        while (length > 0 && buckets[length - 1] == 0)
+        {
+            length--;
+        }
+        var copy = new int[length];
+        Array.Copy(buckets, copy, length);
+        return copy;
+    }
+
+    public void Clear()
+    {
+        Array.Clear(buckets, 0, buckets.Length);
+        count = 0;
+        mean = 0;
+        m2 = 0;
+        max = 0;
+    }
+
+    public override string ToString()
+    {
+        return string.Format("frames {0} mean {1:F2}ms p95 {2:F2}ms p99 {3:F2}ms jitter {4:F2}ms max {5:F2}ms", count, Mean, P95, P99, Jitter, max);
+    }
+}
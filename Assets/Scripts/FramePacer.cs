@@ -0,0 +1,103 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+//holds frames to a target period with a coarse sleep followed by a short spin
+//the spin starts a calibrated slack before the deadline, sized from how late Thread.Sleep has been waking up
+//no UnityEngine dependency so it can be measured outside the player
+public class FramePacer
+{
+    const double MinSlackMs = 0.25;
+    const double MaxSlackMs = 4;
+    readonly double tickMs = 1000.0 / Stopwatch.Frequency;
+    long periodTicks;
+    long deadline;
+    long lastFrame;
+    double slackMs = 2;
+
+    public FrameIntervalHistogram Intervals { get; } = new FrameIntervalHistogram();
+    //time parked in Thread.Sleep, costs no CPU
+    public double SleepMs { get; private set; }
+    //time burnt spinning up to the deadline
+    public double SpinMs { get; private set; }
+    public double SlackMs => slackMs;
+    public int MissedDeadlines { get; private set; }
+
+    public FramePacer(double targetFps)
+    {
+        SetTarget(targetFps);
+        lastFrame = Stopwatch.GetTimestamp();
+        deadline = lastFrame;
+    }
+
+    public void SetTarget(double targetFps)
+    {
+        periodTicks = (long)(Stopwatch.Frequency / targetFps);
+    }
+
+    //call once per frame, returns when the next frame is due
+    public void Wait()
+    {
+        deadline += periodTicks;
+        long now = Stopwatch.GetTimestamp();
+        if (now > deadline)
+        {
+            //frame ran long, start counting from here instead of trying to catch up
+            MissedDeadlines++;
+            deadline = now;
+        }
+
+        double remainingMs = (deadline - now) * tickMs;
+        if (remainingMs > slackMs)
+        {
+            int requested = (int)(remainingMs - slackMs);
+            if (requested > 0)
+            {
+                long before = Stopwatch.GetTimestamp();
+                Thread.Sleep(requested);
+                long after = Stopwatch.GetTimestamp();
+                double slept = (after - before) * tickMs;
+                SleepMs += slept;
+                Calibrate(slept - requested);
+            }
+        }
+
+        long spinStart = Stopwatch.GetTimestamp();
+        while (Stopwatch.GetTimestamp() < deadline)
+        {
+            Thread.SpinWait(32);
+        }
+        long end = Stopwatch.GetTimestamp();
+        SpinMs += (end - spinStart) * tickMs;
+        Record(end);
+    }
+
+    //for frames paced by someone else, keeps the histogram going
+    public void Record()
+    {
+        Record(Stopwatch.GetTimestamp());
+    }
+
+    void Record(long now)
+    {
+        Intervals.Add((now - lastFrame) * tickMs);
+        lastFrame = now;
+    }
+
+    //grow quickly when sleep overshoots, shrink slowly when it is accurate
+    void Calibrate(double oversleepMs)
+    {
+        double wanted = oversleepMs * 1.5 + MinSlackMs;
+        double rate = wanted > slackMs ? 0.5 : 0.02;
+        slackMs += (wanted - slackMs) * rate;
+        slackMs = Math.Min(Math.Max(slackMs, MinSlackMs), MaxSlackMs);
+    }
+
+    public void ResetStats()
+    {
+        Intervals.Clear();
+        SleepMs = 0;
+        SpinMs = 0;
+        MissedDeadlines = 0;
+    }
+}
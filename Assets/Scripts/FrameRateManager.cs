@@ -1,34 +1,60 @@
 using System.Collections;
-using System.Threading;
 using UnityEngine;
 
 public class FrameRateManager : MonoBehaviour
 {
+    public enum PacingMode
+    {
+        //Application.targetFrameRate, lets the platform pace frames without waking the CPU
+        Platform,
+        //FramePacer sleep + short spin, for when exact intervals matter more than power
+        Hybrid
+    }
+
     [Header("Frame Settings")]
     public int MaxRate = 9999;
     public float TargetFrameRate = 60.0f;
-    float currentFrameTime;
+    public PacingMode Mode = PacingMode.Platform;
+    FramePacer pacer;
+
+    public FramePacer Pacer => pacer;
 
     void Awake()
     {
         QualitySettings.vSyncCount = 0;
-        Application.targetFrameRate = MaxRate;
-        currentFrameTime = Time.realtimeSinceStartup;
+        pacer = new FramePacer(TargetFrameRate);
+        Apply();
         StartCoroutine("WaitForNextFrame");
     }
 
+    void OnValidate()
+    {
+        if (pacer != null)
+        {
+            Apply();
+        }
+    }
+
+    void Apply()
+    {
+        pacer.SetTarget(TargetFrameRate);
+        Application.targetFrameRate = Mode == PacingMode.Platform ? Mathf.RoundToInt(TargetFrameRate) : MaxRate;
+    }
+
     IEnumerator WaitForNextFrame()
     {
+        var endOfFrame = new WaitForEndOfFrame();
         while (true)
         {
-            yield return new WaitForEndOfFrame();
-            currentFrameTime += 1.0f / TargetFrameRate;
-            var t = Time.realtimeSinceStartup;
-            var sleepTime = currentFrameTime - t - 0.01f;
-            if (sleepTime > 0)
-                Thread.Sleep((int)(sleepTime * 1000));
-            while (t < currentFrameTime)
-                t = Time.realtimeSinceStartup;
+            yield return endOfFrame;
+            if (Mode == PacingMode.Hybrid)
+            {
+                pacer.Wait();
+            }
+            else
+            {
+                pacer.Record();
+            }
         }
     }
-}
\ No newline at end of file
+}
@@ -1,30 +1,95 @@
 using System.Collections;
 using System.Collections.Generic;
+using System.Diagnostics;
 using UnityEngine;
 using UnityEngine.UI;
 
 public class GameManager : MonoBehaviour
 {
+    const string HighScoreKey = "HighScore : ";
+    //every character the score labels can show
+    const string ScoreGlyphs = "Score : HighScore0123456789-";
     int score = 0;
     int highScore = 0;
+    //set when the run beats the stored high score, written out once by SaveHighScore
+    bool highScoreDirty;
     public static GameManager inst;
     [SerializeField] Text ScoreText;
+    //optional TMP score label, patched glyph by glyph instead of rebuilt on every coin
+    [SerializeField] IncrementalText scoreCounter;
     [SerializeField] Text highScoreText;
     [SerializeField] SwerveMovement playerMovement;
+    //score strings formatted up front so early coins never allocate, higher scores are formatted once when first reached
+    [SerializeField] int prewarmScoreLabels = 256;
+    NumberLabel scoreLabel;
+    //logs LastRestartMs after every soft restart in development builds
+    [SerializeField] bool logRestarts = false;
+
+    //time from RestartRun to the end of the first frame rendered after it
+    public double LastRestartMs { get; private set; }
 
     public void IncrementScore()
     {
         score++;
-        ScoreText.text = "Score : " +score;
+        ShowScore();
         //inc player speed
         playerMovement.speed += playerMovement.speedIncperpoint;
-        if(score > PlayerPrefs.GetInt("HighScore : ", 0))
+        if(score > highScore)
         {
-            PlayerPrefs.SetInt("HighScore : ", score);
             highScore = score;
+            highScoreDirty = true;
         }
     }
 
+    //called when the player dies
+    public void EndRun()
+    {
+        SaveHighScore();
+    }
+
+    //soft restart: everything stays loaded, only the run state goes back to the start
+    public void RestartRun()
+    {
+        long start = Stopwatch.GetTimestamp();
+        score = 0;
+        ShowScore();
+        highScoreText.text = "HighScore : " +highScore.ToString();
+        playerMovement.ResetRun();
+        Services.Get<GroundSpawner>().ResetTrack();
+        StartCoroutine(MeasureRestart(start));
+    }
+
+    void ShowScore()
+    {
+        if (scoreCounter != null)
+        {
+            scoreCounter.SetText(scoreLabel.Get(score));
+            return;
+        }
+        ScoreText.text = scoreLabel.Get(score);
+    }
+
+    IEnumerator MeasureRestart(long start)
+    {
+        yield return new WaitForEndOfFrame();
+        LastRestartMs = (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+        if (logRestarts && UnityEngine.Debug.isDebugBuild)
+        {
+            UnityEngine.Debug.Log("Soft restart to playable: " + LastRestartMs.ToString("F2") + " ms");
+        }
+    }
+
+    public void SaveHighScore()
+    {
+        if (!highScoreDirty)
+        {
+            return;
+        }
+        highScoreDirty = false;
+        PlayerPrefs.SetInt(HighScoreKey, highScore);
+        PlayerPrefs.Save();
+    }
+
     void Awake()
     {
         inst = this;
@@ -33,7 +98,28 @@ public class GameManager : MonoBehaviour
     // Start is called before the first frame update
     void Start()
     {
-        highScore = PlayerPrefs.GetInt("HighScore : ", 0);
+        highScore = PlayerPrefs.GetInt(HighScoreKey, 0);
         highScoreText.text = "HighScore : " +highScore.ToString();
+        scoreLabel = new NumberLabel("Score : ", prewarmScoreLabels);
+        //rasterize the digits now, a few per frame, instead of on the first coin or the first new best
+        GlyphPrewarmer.Prewarm(ScoreText.font, ScoreText.fontSize, ScoreText.fontStyle, ScoreGlyphs);
+        GlyphPrewarmer.Prewarm(highScoreText.font, highScoreText.fontSize, highScoreText.fontStyle, ScoreGlyphs);
+        if (scoreCounter != null)
+        {
+            GlyphPrewarmer.Prewarm(scoreCounter.Text.font, ScoreGlyphs);
+        }
+    }
+
+    void OnApplicationPause(bool paused)
+    {
+        if (paused)
+        {
+            SaveHighScore();
+        }
+    }
+
+    void OnDestroy()
+    {
+        SaveHighScore();
     }
 }
@@ -0,0 +1,20 @@
+//running totals of the engine work the gameplay code asks for, read by the simulation harness
+public static class GameplayCounters
+{
+    public static int TilesSpawned;
+    public static int Instantiates;
+    public static int Destroys;
+    public static int TriggerCallbacks;
+    public static int CollisionCallbacks;
+    public static int CoinsCollected;
+
+    public static void Reset()
+    {
+        TilesSpawned = 0;
+        Instantiates = 0;
+        Destroys = 0;
+        TriggerCallbacks = 0;
+        CollisionCallbacks = 0;
+        CoinsCollected = 0;
+    }
+}
@@ -0,0 +1,197 @@
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Threading.Tasks;
+using TMPro;
+using UnityEngine;
+
+//adds glyphs to dynamic font atlases ahead of use, a few per frame within a time budget
+//character sets are read and de-duplicated on a worker thread; rasterizing stays on the main thread
+//because FontEngine and the atlas textures may only be touched from there
+//each frame makes at most one TryAddCharacters call, so the atlas is uploaded at most once per frame
+public class GlyphPrewarmer : MonoBehaviour
+{
+    static GlyphPrewarmer inst;
+
+    class Job
+    {
+        public TMP_FontAsset font;
+        public Font legacyFont;
+        public int size;
+        public FontStyle style;
+        public string characters;
+        public int next;
+    }
+
+    readonly Queue<Job> jobs = new Queue<Job>();
+    //jobs whose characters are still being read on a worker thread
+    readonly ConcurrentQueue<Job> loaded = new ConcurrentQueue<Job>();
+    readonly char[] batch = new char[256];
+    int loading;
+    //running estimate used to size each frame's batch
+    double msPerGlyph = 0.05;
+
+    public static float BudgetMs = 1f;
+    public static int Pending => inst == null ? 0 : inst.jobs.Count + inst.loading;
+    public static int GlyphsAdded { get; private set; }
+    public static double LastFrameMs { get; private set; }
+    public static double MaxFrameMs { get; private set; }
+
+    static GlyphPrewarmer Instance
+    {
+        get
+        {
+            if (inst == null)
+            {
+                inst = new GameObject("GlyphPrewarmer").AddComponent<GlyphPrewarmer>();
+                DontDestroyOnLoad(inst.gameObject);
+            }
+            return inst;
+        }
+    }
+
+    public static void Prewarm(TMP_FontAsset font, string characters)
+    {
+        if (font != null && font.atlasPopulationMode == AtlasPopulationMode.Dynamic)
+        {
+            Instance.Load(new Job { font = font }, characters);
+        }
+    }
+
+    //every character used by a table of strings, e.g. all the banners a screen can show
+    public static void Prewarm(TMP_FontAsset font, IList<string> table)
+    {
+        Prewarm(font, string.Concat(table));
+    }
+
+    //a UTF-8 character-set file, read off the main thread
+    public static void PrewarmFile(TMP_FontAsset font, string path)
+    {
+        if (font != null && font.atlasPopulationMode == AtlasPopulationMode.Dynamic)
+        {
+            Instance.LoadFile(new Job { font = font }, path);
+        }
+    }
+
+    //legacy UI Text fonts are cached per size and style
+    public static void Prewarm(Font font, int size, FontStyle style, string characters)
+    {
+        if (font != null && font.dynamic)
+        {
+            Instance.Load(new Job { legacyFont = font, size = size, style = style }, characters);
+        }
+    }
+
+    void Load(Job job, string characters)
+    {
+        loading++;
+        Task.Run(() =>
+        {
+            job.characters = Unique(characters);
+            loaded.Enqueue(job);
+        });
+    }
+
+    void LoadFile(Job job, string path)
+    {
+        loading++;
+        Task.Run(() =>
+        {
+            job.characters = File.Exists(path) ? Unique(File.ReadAllText(path)) : "";
+            loaded.Enqueue(job);
+        });
+    }
+
+    //each character once, without whitespace, controls or surrogate halves the atlas API cannot take
+    static string Unique(string characters)
+    {
+        var seen = new HashSet<char>();
+        var unique = new char[characters.Length];
+        int count = 0;
+        for (int i = 0; i < characters.Length; i++)
+        {
+            char c = characters[i];
+            if (char.IsWhiteSpace(c) || char.IsControl(c) || char.IsSurrogate(c) || !seen.Add(c))
+            {
+                continue;
+            }
+            unique[count++] = c;
+        }
+        return new string(unique, 0, count);
+    }
+
+    void Update()
+    {
+        Job ready;
+        while (loaded.TryDequeue(out ready))
+        {
+            loading--;
+            jobs.Enqueue(ready);
+        }
+        if (jobs.Count == 0)
+        {
+            return;
+        }
+
+        long start = Stopwatch.GetTimestamp();
+        Job job = jobs.Peek();
+        int wanted = Mathf.Clamp((int)(BudgetMs / msPerGlyph), 1, batch.Length);
+        int count = 0;
+        while (count < wanted && job.next < job.characters.Length)
+        {
+            char c = job.characters[job.next++];
+            if (!Present(job, c))
+            {
+                batch[count++] = c;
+            }
+        }
+        if (count > 0)
+        {
+            string characters = new string(batch, 0, count);
+            if (job.font != null)
+            {
+                string missing;
+                job.font.TryAddCharacters(characters, out missing);
+            }
+            else
+            {
+                job.legacyFont.RequestCharactersInTexture(characters, job.size, job.style);
+            }
+            GlyphsAdded += count;
+        }
+        if (job.next >= job.characters.Length)
+        {
+            jobs.Dequeue();
+        }
+
+        double ms = (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+        LastFrameMs = ms;
+        if (ms > MaxFrameMs)
+        {
+            MaxFrameMs = ms;
+        }
+        if (count > 0)
+        {
+            msPerGlyph = msPerGlyph * 0.75 + ms / count * 0.25;
+        }
+    }
+
+    static bool Present(Job job, char c)
+    {
+        if (job.font != null)
+        {
+            return job.font.HasCharacter(c);
+        }
+        CharacterInfo info;
+        return job.legacyFont.GetCharacterInfo(c, out info, job.size, job.style);
+    }
+
+    void OnDestroy()
+    {
+        if (inst == this)
+        {
+            inst = null;
+        }
+    }
+}
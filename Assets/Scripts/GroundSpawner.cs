@@ -1,33 +1,196 @@
 
+using Unity.Profiling;
 using UnityEngine;
 
-public class GroundSpawner : MonoBehaviour
+public class GroundSpawner : MonoBehaviour, IOriginShift
 {
     [SerializeField] GameObject groundtile;
+    //fewest tiles kept ahead of the player, the window grows from here with speed
+    [SerializeField] int minTileCount = 6;
+    [SerializeField] int maxTileCount = 48;
+    //track laid ahead is the distance covered in this time plus minLookahead, capped at the camera's far plane
+    [SerializeField] float lookaheadSeconds = 3f;
+    //the 150 m the old fixed 15 tiles showed, the far plane is well past it and there is no fog to hide a shorter track
+    [SerializeField] float minLookahead = 150f;
+    //tiles added per passed tile when the window has to grow, spreads the cost of a speed jump
+    [SerializeField] int maxGrowPerTile = 3;
+    [SerializeField] Camera viewCamera;
+    //test coins, obstacles and tile exits analytically instead of through PhysX callbacks
+    [SerializeField] bool analyticCollision = false;
+    //extra ring slots for tiles still lingering behind the player
+    [SerializeField] int poolSlack = 3;
+    [SerializeField] float recycleDelay = 1f;
+    //resolution of the baked coin spawn grid
+    [SerializeField] int coinSlotColumns = 9;
+    [SerializeField] int coinSlotRows = 20;
+    //0 picks a new seed every run
+    [SerializeField] int seed = 0;
+    [SerializeField] int generatorLookahead = 32;
     Vector3 nextSpawnPoint;
+    TilePool tilePool;
+    SpawnSlotTable coinSlots;
+    TrackGenerator trackGenerator;
+    SwerveMovement player;
+    FloatingOrigin floatingOrigin;
+    LaneCollision laneCollision;
+    float tileLength;
+    int liveTiles;
+    static readonly ProfilerCounterValue<int> liveTileCounter =
+        new ProfilerCounterValue<int>(ProfilerCategory.Scripts, "Live Tiles", ProfilerMarkerDataUnit.Count);
+
+    public GameObject TilePrefab => groundtile;
+    public SpawnSlotTable CoinSlots => coinSlots;
+    public TilePool TilePool => tilePool;
+    //null unless analytic collision is on
+    public LaneCollision LaneCollision => laneCollision;
+    public TrackGenerator TrackGenerator => trackGenerator;
+    //tiles laid and not yet run past
+    public int LiveTiles => liveTiles;
+
     // Start is called before the first frame update
     public void SpawnTile(bool spawnItems)
     {
-        GameObject temp = Instantiate(groundtile, nextSpawnPoint, Quaternion.identity);
-        nextSpawnPoint = temp.transform.GetChild(1).transform.position;
+        GroundTile tile = tilePool.Spawn(nextSpawnPoint);
+        nextSpawnPoint = tile.NextSpawnPoint;
+        if (laneCollision != null)
+        {
+            laneCollision.Add(tile);
+        }
+        liveTiles++;
+        GameplayCounters.TilesSpawned++;
+        liveTileCounter.Value = liveTiles;
         if(spawnItems)
         {
-            temp.GetComponent<GroundTile>().SpawnObstacle();
-            temp.GetComponent<GroundTile>().SpawnCoins();
+            TrackChunk chunk = trackGenerator.Next();
+            tile.SpawnObstacle(chunk);
+            tile.SpawnCoins(chunk, coinSlots);
+        }
+    }
+
+    private void Awake()
+    {
+        Services.Register(this);
+        //the origin shifter lives with the spawner so every game scene gets one
+        floatingOrigin = GetComponent<FloatingOrigin>();
+        if (floatingOrigin == null)
+        {
+            floatingOrigin = gameObject.AddComponent<FloatingOrigin>();
+        }
+        floatingOrigin.Add(this);
+        tileLength = groundtile.GetComponent<GroundTile>().GetLength();
+        floatingOrigin.Snap = tileLength;
+        if (analyticCollision || LaneCollision.Forced)
+        {
+            laneCollision = new LaneCollision();
+        }
+    }
+
+    //the player only supports analytic collision as a kinematic body
+    public void DisableLaneCollision()
+    {
+        laneCollision = null;
+    }
+
+    public void ShiftOrigin(Vector3 offset)
+    {
+        nextSpawnPoint += offset;
+        tilePool.Shift(offset);
+    }
+
+    //called as the player leaves a tile, tops the window up to what the current speed needs
+    //a window that is too long shrinks by not replacing the passed tile
+    public void TilePassed()
+    {
+        liveTiles--;
+        int required = RequiredTiles();
+        for (int i = 0; i < maxGrowPerTile && liveTiles < required; i++)
+        {
+            SpawnTile(true);
+        }
+        liveTileCounter.Value = liveTiles;
+    }
+
+    //tiles needed to keep the track laid past the lookahead distance, counting the one under the player
+    public int RequiredTiles()
+    {
+        float speed = player != null ? player.speed : 0;
+        float distance = minLookahead + speed * lookaheadSeconds;
+        if (viewCamera != null)
+        {
+            distance = Mathf.Min(distance, viewCamera.farClipPlane);
         }
+        int required = Mathf.CeilToInt(distance / tileLength) + 1;
+        return Mathf.Clamp(required, minTileCount, maxTileCount);
     }
+
+    public void ReleaseTile(GroundTile tile)
+    {
+        tilePool.Release(tile);
+    }
+
     private void Start()
     {
-        for(int i = 0;i < 15; i++)
+        player = Services.Get<SwerveMovement>();
+        if (viewCamera == null)
+        {
+            viewCamera = Camera.main;
+        }
+        GroundTile tilePrefab = groundtile.GetComponent<GroundTile>();
+        //the ring is sized for the longest window, slots are only filled as it grows
+        int capacity = maxTileCount + poolSlack;
+        tilePool = new TilePool(groundtile, capacity, recycleDelay);
+        coinSlots = SpawnSlotTable.For(groundtile, coinSlotColumns, coinSlotRows);
+        tilePrefab.PrewarmPools(RequiredTiles() + poolSlack, capacity * 2);
+        trackGenerator = new TrackGenerator(tilePrefab.GetTrackSettings(coinSlots.Count), generatorLookahead);
+        trackGenerator.Start(NextSeed());
+        LayTrack();
+        //everything after the warm-up is expected to resolve through Services
+        Services.GameplayActive = true;
+    }
+
+    //lay the track out again from the start, reusing the tiles and items already in the pools
+    public void ResetTrack()
+    {
+        trackGenerator.Start(NextSeed());
+        tilePool.ReleaseAll();
+        floatingOrigin.ResetOffset();
+        if (laneCollision != null)
+        {
+            laneCollision.Clear();
+        }
+        nextSpawnPoint = Vector3.zero;
+        liveTiles = 0;
+        LayTrack();
+    }
+
+    ulong NextSeed()
+    {
+        return seed != 0 ? (ulong)seed : (ulong)System.DateTime.Now.Ticks;
+    }
+
+    void LayTrack()
+    {
+        int count = RequiredTiles();
+        for(int i = 0;i < count; i++)
         {
             if (i<2)
             {
                 SpawnTile(false);
             }
-            else 
+            else
             {
                 SpawnTile(true);
-            }    
+            }
+        }
+    }
+
+    private void OnDestroy()
+    {
+        Services.GameplayActive = false;
+        Services.Unregister(this);
+        if (trackGenerator != null)
+        {
+            trackGenerator.Stop();
         }
     }
 }
@@ -1,3 +1,4 @@
+using System.Collections.Generic;
 using UnityEngine;
 
 public class GroundTile : MonoBehaviour {
@@ -8,58 +9,331 @@ public class GroundTile : MonoBehaviour {
     [SerializeField] GameObject coinPrefab;
     [SerializeField] GameObject tallObstaclePrefab;
     [SerializeField] float tallObstacleChance = 0.1f;
+    [SerializeField, Range(0, 1)] float coinChance = 1f;
 
-    private void Start () 
+    //child indices of the next tile point and the obstacle anchors in the tile prefab
+    const int nextTileChild = 1;
+    const int firstObstacleChild = 2;
+    const int secondObstacleChild = 6;
+    const int lastObstacleChild = 8;
+
+    //an item spawned onto this tile, with the pool generation it was spawned in
+    struct SpawnedItem
+    {
+        public PooledObject item;
+        public int generation;
+    }
+
+    //spawn anchors as offsets from the tile origin, read from the prefab's children once
+    struct Anchors
+    {
+        public Vector3 nextTile;
+        public Vector3[] firstObstacle;
+        public Vector3[] secondObstacle;
+    }
+
+    //set by TilePool for tiles that live in the ring
+    [System.NonSerialized] public bool pooled;
+    bool armed = true;
+    readonly List<SpawnedItem> spawnedItems = new List<SpawnedItem>();
+    Anchors anchors;
+    Vector3 origin;
+    //half extents on the ground plane, used to keep coins out of obstacles
+    Vector2 firstObstacleFootprint;
+    Vector2 tallObstacleFootprint;
+    Vector2 secondObstacleFootprint;
+    //the coin's radius on the ground plane, coins closer than this to an obstacle are not spawned
+    float coinRadius;
+    //items on this tile sorted by zMin, for LaneCollision
+    LaneItem[] laneItems = new LaneItem[8];
+    int laneItemCount;
+
+    public Vector3 NextSpawnPoint => origin + anchors.nextTile;
+    public float StartZ => origin.z;
+    public float EndZ => origin.z + anchors.nextTile.z;
+    public int LaneItemCount => laneItemCount;
+
+    public LaneItem GetLaneItem(int index)
+    {
+        return laneItems[index];
+    }
+
+    private void Awake()
+    {
+        origin = transform.position;
+        anchors.nextTile = transform.GetChild(nextTileChild).localPosition;
+        anchors.firstObstacle = ChildOffsets(firstObstacleChild, secondObstacleChild);
+        anchors.secondObstacle = ChildOffsets(secondObstacleChild, lastObstacleChild);
+        firstObstacleFootprint = Footprint(obstaclePrefab);
+        tallObstacleFootprint = Footprint(tallObstaclePrefab);
+        secondObstacleFootprint = Vector2.Max(Footprint(obstaclePrefab2), Footprint(tallObstaclePrefab));
+        coinRadius = Radius(coinPrefab);
+    }
+
+    static Vector2 Footprint(GameObject prefab)
+    {
+        BoxCollider box = prefab.GetComponent<BoxCollider>();
+        Vector3 size = Vector3.Scale(box.size, prefab.transform.localScale);
+        return new Vector2(size.x, size.z) * 0.5f;
+    }
+
+    //coins stand upright, so their capsule's radius is what they cover on the ground
+    static float Radius(GameObject prefab)
+    {
+        CapsuleCollider capsule = prefab.GetComponent<CapsuleCollider>();
+        Vector3 scale = prefab.transform.localScale;
+        return capsule.radius * Mathf.Max(Mathf.Abs(scale.x), Mathf.Abs(scale.z));
+    }
+
+    Vector3[] ChildOffsets(int from, int to)
+    {
+        var offsets = new Vector3[to - from];
+        for (int i = 0; i < offsets.Length; i++)
+        {
+            offsets[i] = transform.GetChild(from + i).localPosition;
+        }
+        return offsets;
+    }
+
+    private void Start ()
     {
-        groundSpawner = GameObject.FindObjectOfType<GroundSpawner>();   
+        groundSpawner = Services.Get<GroundSpawner>();
 	}
 
     private void OnTriggerExit (Collider other)
     {
-        groundSpawner.SpawnTile(true);
-        Destroy(gameObject ,1);
+        GameplayCounters.TriggerCallbacks++;
+        if (!armed || other.gameObject.layer != EntityLayers.Player)
+        {
+            return;
+        }
+        //a tile moved out from under the player on restart is not a tile the player ran past
+        if (other.transform.position.z < origin.z)
+        {
+            return;
+        }
+        Passed();
     }
-    
-    public void SpawnObstacle()
+
+    //the player has left the tile, by its trigger or by LaneCollision
+    public void Passed()
     {
-        //choose which obstacle to spawn
-        GameObject obstacleToSpawn = obstaclePrefab;
-        float random = Random.Range(0f,1f);
-        if (random < tallObstacleChance)
+        if (!armed)
         {
-            obstacleToSpawn = tallObstaclePrefab;
+            return;
+        }
+        armed = false;
+        groundSpawner.TilePassed();
+        if (pooled)
+        {
+            groundSpawner.ReleaseTile(this);
+        }
+        else
+        {
+            GameplayCounters.Destroys++;
+            Destroy(gameObject ,1);
+        }
+    }
+
+    //move the tile to its new place in the track and clear what was spawned on it
+    public void Recycle(Vector3 position)
+    {
+        transform.position = position;
+        origin = position;
+        ClearItems();
+        if (!gameObject.activeSelf)
+        {
+            gameObject.SetActive(true);
+        }
+        armed = true;
+    }
+
+    //items are parented to the tile and move with it
+    public void ShiftOrigin(Vector3 offset)
+    {
+        transform.position += offset;
+        origin += offset;
+        for (int i = 0; i < laneItemCount; i++)
+        {
+            laneItems[i].zMin += offset.z;
+            laneItems[i].zMax += offset.z;
         }
-        int obstacleSpawnIndex = Random.Range(2, 6);
-        Transform spawnPoint = transform.GetChild(obstacleSpawnIndex).transform;
-        Instantiate(obstaclePrefab , spawnPoint.position , Quaternion.identity, transform);
-        int obstacleSpawnIndex1 = Random.Range(6, 8);
-        Transform spawnPoint1 = transform.GetChild(obstacleSpawnIndex1).transform;
-        Instantiate(obstaclePrefab2 , spawnPoint1.position , Quaternion.identity, transform);
-        Instantiate(tallObstaclePrefab , spawnPoint1.position , Quaternion.identity, transform);
     }
-    public void SpawnCoins()
+
+    //hidden and empty until the pool recycles it again
+    public void Park()
+    {
+        ClearItems();
+        gameObject.SetActive(false);
+    }
+
+    void ClearItems()
+    {
+        for (int i = 0; i < spawnedItems.Count; i++)
+        {
+            //picked up coins may already be back in the pool or on another tile
+            SpawnedItem spawned = spawnedItems[i];
+            if (spawned.item.live && spawned.item.generation == spawned.generation)
+            {
+                spawned.item.Despawn();
+            }
+        }
+        spawnedItems.Clear();
+        laneItemCount = 0;
+    }
+
+    void AddSpawned(PooledObject item)
+    {
+        spawnedItems.Add(new SpawnedItem { item = item, generation = item.generation });
+    }
+
+    //coin is null for obstacles
+    void AddLaneItem(PooledObject item, Coin coin, Vector3 position, Vector2 halfExtents)
+    {
+        if (laneItemCount == laneItems.Length)
+        {
+            System.Array.Resize(ref laneItems, laneItems.Length * 2);
+        }
+        LaneItem entry;
+        entry.xMin = position.x - halfExtents.x;
+        entry.xMax = position.x + halfExtents.x;
+        entry.zMin = position.z - halfExtents.y;
+        entry.zMax = position.z + halfExtents.y;
+        entry.item = item;
+        entry.generation = item.generation;
+        entry.coin = coin;
+        entry.obstacle = coin == null;
+        int i = laneItemCount++;
+        while (i > 0 && laneItems[i - 1].zMin > entry.zMin)
+        {
+            laneItems[i] = laneItems[i - 1];
+            i--;
+        }
+        laneItems[i] = entry;
+    }
+
+    //fill the obstacle and coin pools for the given number of live tiles
+    public void PrewarmPools(int tiles, int maxTiles)
+    {
+        var perTile = new Dictionary<GameObject, int>();
+        //the first anchor holds either obstacle, so both pools cover it
+        CountPerTile(perTile, obstaclePrefab, 1);
+        CountPerTile(perTile, tallObstaclePrefab, 1);
+        CountPerTile(perTile, obstaclePrefab2, 1);
+        CountPerTile(perTile, tallObstaclePrefab, 1);
+        CountPerTile(perTile, coinPrefab, TrackChunk.CoinCount);
+        foreach (var entry in perTile)
+        {
+            ObjectPools.Prewarm(entry.Key, entry.Value * tiles, entry.Value * maxTiles);
+        }
+    }
+
+    static void CountPerTile(Dictionary<GameObject, int> perTile, GameObject prefab, int count)
     {
-        int coinstospawn = 2;
-        for(int i = 0; i < coinstospawn; i++)
+        int current;
+        perTile.TryGetValue(prefab, out current);
+        perTile[prefab] = current + count;
+    }
+
+    //distance from one tile's origin to the next, read from the prefab
+    public float GetLength()
+    {
+        return transform.GetChild(nextTileChild).localPosition.z;
+    }
+
+    //generator inputs, read from the prefab before any tile exists
+    public TrackSettings GetTrackSettings(int coinSlots)
+    {
+        TrackSettings settings;
+        settings.tallObstacleChance = tallObstacleChance;
+        settings.firstObstacleLanes = secondObstacleChild - firstObstacleChild;
+        settings.secondObstacleLanes = lastObstacleChild - secondObstacleChild;
+        settings.coinSlots = coinSlots;
+        settings.coinChance = coinChance;
+        return settings;
+    }
+
+    //tile geometry for the run model, read from the prefab in tile-local x/z
+    public TrackLayout GetTrackLayout(SpawnSlotTable slots)
+    {
+        TrackLayout layout;
+        layout.length = GetLength();
+        layout.firstObstacle = Flatten(ChildOffsets(firstObstacleChild, secondObstacleChild));
+        layout.secondObstacle = Flatten(ChildOffsets(secondObstacleChild, lastObstacleChild));
+        layout.firstFootprint = Footprint(obstaclePrefab);
+        layout.tallFootprint = Footprint(tallObstaclePrefab);
+        layout.secondFootprint = Vector2.Max(Footprint(obstaclePrefab2), Footprint(tallObstaclePrefab));
+        layout.coinSlots = new Vector2[slots.Count];
+        for (int i = 0; i < slots.Count; i++)
+        {
+            layout.coinSlots[i] = new Vector2(slots[i].x, slots[i].z);
+        }
+        layout.coinRadius = Radius(coinPrefab);
+        return layout;
+    }
+
+    static Vector2[] Flatten(Vector3[] points)
+    {
+        var flat = new Vector2[points.Length];
+        for (int i = 0; i < points.Length; i++)
         {
-            GameObject temp = Instantiate(coinPrefab, transform);
-            temp.transform.position = GetRandomPointInCollider(GetComponent<Collider>());
+            flat[i] = new Vector2(points[i].x, points[i].z);
+        }
+        return flat;
+    }
 
+    public void SpawnObstacle(TrackChunk chunk)
+    {
+        //choose which obstacle to spawn
+        GameObject obstacleToSpawn = obstaclePrefab;
+        Vector2 footprint = firstObstacleFootprint;
+        if (chunk.tallRoll)
+        {
+            obstacleToSpawn = tallObstaclePrefab;
+            footprint = tallObstacleFootprint;
         }
+        int obstacleSpawnIndex = chunk.firstObstacleLane;
+        Vector3 spawnPoint = origin + anchors.firstObstacle[obstacleSpawnIndex];
+        PooledObject first = ObjectPools.Spawn(obstacleToSpawn , spawnPoint , Quaternion.identity, transform);
+        AddSpawned(first);
+        AddLaneItem(first, null, spawnPoint, footprint);
+        int obstacleSpawnIndex1 = chunk.secondObstacleLane;
+        Vector3 spawnPoint1 = origin + anchors.secondObstacle[obstacleSpawnIndex1];
+        PooledObject second = ObjectPools.Spawn(obstaclePrefab2 , spawnPoint1 , Quaternion.identity, transform);
+        AddSpawned(second);
+        AddSpawned(ObjectPools.Spawn(tallObstaclePrefab , spawnPoint1 , Quaternion.identity, transform));
+        //both obstacles share the anchor, one entry with the larger footprint covers them
+        AddLaneItem(second, null, spawnPoint1, secondObstacleFootprint);
     }
-    Vector3 GetRandomPointInCollider (Collider collider)
+    public void SpawnCoins(TrackChunk chunk, SpawnSlotTable slots)
     {
-        Vector3 point = new Vector3
-        (
-            Random.Range(collider.bounds.min.x , collider.bounds.max.x),
-            Random.Range(collider.bounds.min.y , collider.bounds.max.y),
-            Random.Range(collider.bounds.min.z , collider.bounds.max.z)
-        );
-        if (point != collider.ClosestPoint(point))
+        Vector3 firstObstacle = anchors.firstObstacle[chunk.firstObstacleLane];
+        Vector3 secondObstacle = anchors.secondObstacle[chunk.secondObstacleLane];
+        Vector2 firstFootprint = chunk.tallRoll ? tallObstacleFootprint : firstObstacleFootprint;
+        for(int i = 0; i < TrackChunk.CoinCount; i++)
         {
-            point = GetRandomPointInCollider(collider);
+            //coins and obstacles no longer collide, so overlapping coins are skipped here instead
+            if (!chunk.HasCoin(i))
+            {
+                continue;
+            }
+            Vector3 slot = slots[chunk.CoinSlot(i)];
+            if (Overlaps(slot, firstObstacle, firstFootprint) || Overlaps(slot, secondObstacle, secondObstacleFootprint))
+            {
+                continue;
+            }
+            PooledObject temp = ObjectPools.Spawn(coinPrefab, transform);
+            Vector3 point = origin + slot;
+            point.y = 1;
+            temp.transform.position = point;
+            AddSpawned(temp);
+            AddLaneItem(temp, temp.coin, point, new Vector2(coinRadius, coinRadius));
         }
-        point.y = 1;
-        return point;
+    }
+
+    bool Overlaps(Vector3 coin, Vector3 obstacle, Vector2 footprint)
+    {
+        return Mathf.Abs(coin.x - obstacle.x) < footprint.x + coinRadius
+            && Mathf.Abs(coin.z - obstacle.z) < footprint.y + coinRadius;
     }
 }
@@ -0,0 +1,251 @@
+using TMPro;
+using UnityEngine;
+using UnityEngine.UI;
+
+//single-line TMP label that rewrites only the glyph quads that changed, for counters that tick often
+//a change is patched in place when the string keeps its length and every new glyph has the old one's advance;
+//anything else, or a label that wraps, auto-sizes or uses rich text, goes through a normal SetText rebuild
+[RequireComponent(typeof(TMP_Text))]
+public class IncrementalText : MonoBehaviour
+{
+    [SerializeField] TMP_Text text;
+    //what the label should show, which is also what the mesh shows once patched
+    string current;
+    //something other than our own SetText marked the label dirty since the canvases last rendered
+    bool dirtied;
+    bool syncing;
+
+    public TMP_Text Text => text;
+    public int Patched { get; private set; }
+    public int Rebuilt { get; private set; }
+
+    void Awake()
+    {
+        if (text == null)
+        {
+            text = GetComponent<TMP_Text>();
+        }
+    }
+
+    void OnEnable()
+    {
+        TMPro_EventManager.TEXT_CHANGED_EVENT.Add(OnTextChanged);
+        text.RegisterDirtyVerticesCallback(OnDirty);
+        text.RegisterDirtyMaterialCallback(OnDirty);
+        text.RegisterDirtyLayoutCallback(OnDirty);
+        //queued rebuilds all run in this same callback, so a dirty mark only has to be remembered until then
+        Canvas.willRenderCanvases += OnCanvasesRendered;
+    }
+
+    void OnDisable()
+    {
+        TMPro_EventManager.TEXT_CHANGED_EVENT.Remove(OnTextChanged);
+        text.UnregisterDirtyVerticesCallback(OnDirty);
+        text.UnregisterDirtyMaterialCallback(OnDirty);
+        text.UnregisterDirtyLayoutCallback(OnDirty);
+        Canvas.willRenderCanvases -= OnCanvasesRendered;
+    }
+
+    void OnDirty()
+    {
+        if (!syncing)
+        {
+            dirtied = true;
+        }
+    }
+
+    void OnCanvasesRendered()
+    {
+        dirtied = false;
+    }
+
+    public void SetText(string value)
+    {
+        if (value == current)
+        {
+            return;
+        }
+        if (!TryPatch(value))
+        {
+            current = value;
+            text.SetText(value);
+            Rebuilt++;
+            return;
+        }
+        current = value;
+        SyncText(value);
+    }
+
+    //hands TMP the patched string without the rebuild SetText queues, so Text.text is right and any rebuild
+    //TMP does on its own (re-enable, colour or material change) lays out the digits already on screen
+    //world-space TextMeshPro rebuilds through its own update manager and is left to OnTextChanged
+    void SyncText(string value)
+    {
+        var graphic = text as TextMeshProUGUI;
+        if (graphic == null)
+        {
+            return;
+        }
+        syncing = true;
+        text.SetText(value);
+        syncing = false;
+        //only drop the rebuild SetText queued, one someone else asked for this frame still has to run
+        if (dirtied)
+        {
+            return;
+        }
+        CanvasUpdateRegistry.UnRegisterCanvasElementForRebuild(graphic);
+        text.havePropertiesChanged = false;
+    }
+
+    //a rebuild that still came from an older string is redone before the frame is drawn
+    void OnTextChanged(Object changed)
+    {
+        if (changed == text && current != null && text.text != current)
+        {
+            text.SetText(current);
+            text.ForceMeshUpdate();
+            Rebuilt++;
+        }
+    }
+
+    bool TryPatch(string value)
+    {
+        TMP_TextInfo info = text.textInfo;
+        //a rebuild is still pending, or the last one laid out something other than plain single-line text
+        if (current == null || text.havePropertiesChanged || info == null
+            || text.enableWordWrapping || text.enableAutoSizing || text.richText
+            || value.Length != current.Length || info.characterCount != current.Length || info.lineCount > 1)
+        {
+            return false;
+        }
+        TMP_FontAsset font = text.font;
+        FontGlyphTable glyphs = FontGlyphTable.For(font);
+        //check every change first so a failed patch leaves the mesh untouched
+        for (int i = 0; i < value.Length; i++)
+        {
+            if (value[i] == current[i])
+            {
+                continue;
+            }
+            TMP_CharacterInfo old = info.characterInfo[i];
+            TMP_Character glyph;
+            if (!old.isVisible || old.fontAsset != font || (old.style & FontStyles.Italic) != 0
+                || !glyphs.TryGet(value[i], out glyph)
+                || glyph.glyph.atlasIndex != old.textElement.glyph.atlasIndex
+                || glyph.glyph.metrics.horizontalAdvance != old.textElement.glyph.metrics.horizontalAdvance)
+            {
+                return false;
+            }
+        }
+        if (text.enableKerning && !KerningUnchanged(info, value, glyphs, KerningTable.For(font)))
+        {
+            return false;
+        }
+
+        TMP_VertexDataUpdateFlags flags = TMP_VertexDataUpdateFlags.None;
+        for (int i = 0; i < value.Length; i++)
+        {
+            TMP_Character glyph;
+            if (value[i] != current[i] && glyphs.TryGet(value[i], out glyph))
+            {
+                Rewrite(info, i, glyph, font);
+                flags = TMP_VertexDataUpdateFlags.Vertices | TMP_VertexDataUpdateFlags.Uv0;
+            }
+        }
+        text.UpdateVertexData(flags);
+        Patched++;
+        return true;
+    }
+
+    //every pair touching a changed glyph has to keep its adjustment, or the glyphs after it would move
+    bool KerningUnchanged(TMP_TextInfo info, string value, FontGlyphTable glyphs, KerningTable kerning)
+    {
+        for (int i = 0; i + 1 < value.Length; i++)
+        {
+            if (value[i] == current[i] && value[i + 1] == current[i + 1])
+            {
+                continue;
+            }
+            TMP_TextElement oldFirst = info.characterInfo[i].textElement;
+            TMP_TextElement oldSecond = info.characterInfo[i + 1].textElement;
+            TMP_Character newFirst;
+            TMP_Character newSecond;
+            if (oldFirst == null || oldSecond == null || !glyphs.TryGet(value[i], out newFirst) || !glyphs.TryGet(value[i + 1], out newSecond))
+            {
+                return false;
+            }
+            KerningTable.Adjustment before;
+            KerningTable.Adjustment after;
+            bool had = kerning.TryGet(oldFirst.glyphIndex, oldSecond.glyphIndex, out before);
+            bool has = kerning.TryGet(newFirst.glyphIndex, newSecond.glyphIndex, out after);
+            if (had != has || (had && !(Same(before.first, after.first) && Same(before.second, after.second))))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool Same(TMP_GlyphValueRecord a, TMP_GlyphValueRecord b)
+    {
+        return a.xPlacement == b.xPlacement && a.yPlacement == b.yPlacement
+            && a.xAdvance == b.xAdvance && a.yAdvance == b.yAdvance;
+    }
+
+    //moves the quad to the new glyph's bearings and atlas rect
+    //padding is recovered from the old quad, so whatever TMP used for this material is kept
+    static void Rewrite(TMP_TextInfo info, int index, TMP_Character character, TMP_FontAsset font)
+    {
+        TMP_CharacterInfo charInfo = info.characterInfo[index];
+        UnityEngine.TextCore.Glyph oldGlyph = charInfo.textElement.glyph;
+        UnityEngine.TextCore.Glyph newGlyph = character.glyph;
+        UnityEngine.TextCore.GlyphMetrics oldMetrics = oldGlyph.metrics;
+        UnityEngine.TextCore.GlyphMetrics newMetrics = newGlyph.metrics;
+        float scale = charInfo.scale;
+
+        Vector3 bl = charInfo.vertex_BL.position;
+        Vector3 tr = charInfo.vertex_TR.position;
+        float padX = (tr.x - bl.x) - oldMetrics.width * scale;
+        float padY = (tr.y - bl.y) - oldMetrics.height * scale;
+        float left = bl.x + (newMetrics.horizontalBearingX - oldMetrics.horizontalBearingX) * scale;
+        float top = tr.y + (newMetrics.horizontalBearingY - oldMetrics.horizontalBearingY) * scale;
+        float right = left + newMetrics.width * scale + padX;
+        float bottom = top - newMetrics.height * scale - padY;
+
+        float width = font.atlasWidth;
+        float height = font.atlasHeight;
+        Vector2 uvBL = charInfo.vertex_BL.uv;
+        float padU = oldGlyph.glyphRect.x - uvBL.x * width;
+        float padV = oldGlyph.glyphRect.y - uvBL.y * height;
+        UnityEngine.TextCore.GlyphRect rect = newGlyph.glyphRect;
+        float u0 = (rect.x - padU) / width;
+        float v0 = (rect.y - padV) / height;
+        float u1 = (rect.x + rect.width + padU) / width;
+        float v1 = (rect.y + rect.height + padV) / height;
+
+        TMP_MeshInfo mesh = info.meshInfo[charInfo.materialReferenceIndex];
+        int v = charInfo.vertexIndex;
+        mesh.vertices[v + 0] = new Vector3(left, bottom, bl.z);
+        mesh.vertices[v + 1] = new Vector3(left, top, bl.z);
+        mesh.vertices[v + 2] = new Vector3(right, top, bl.z);
+        mesh.vertices[v + 3] = new Vector3(right, bottom, bl.z);
+        mesh.uvs0[v + 0] = new Vector2(u0, v0);
+        mesh.uvs0[v + 1] = new Vector2(u0, v1);
+        mesh.uvs0[v + 2] = new Vector2(u1, v1);
+        mesh.uvs0[v + 3] = new Vector2(u1, v0);
+
+        //keep the layout record in step so the next diff starts from what is on screen
+        charInfo.character = (char)character.unicode;
+        charInfo.textElement = character;
+        charInfo.vertex_BL.position = mesh.vertices[v + 0];
+        charInfo.vertex_TL.position = mesh.vertices[v + 1];
+        charInfo.vertex_TR.position = mesh.vertices[v + 2];
+        charInfo.vertex_BR.position = mesh.vertices[v + 3];
+        charInfo.vertex_BL.uv = mesh.uvs0[v + 0];
+        charInfo.vertex_TL.uv = mesh.uvs0[v + 1];
+        charInfo.vertex_TR.uv = mesh.uvs0[v + 2];
+        charInfo.vertex_BR.uv = mesh.uvs0[v + 3];
+        info.characterInfo[index] = charInfo;
+    }
+}
@@ -0,0 +1,144 @@
+using System.Collections.Generic;
+using TMPro;
+
+//glyph pair adjustments of a TMP font asset in one flat open-addressed table
+//keys pack both 32-bit glyph indices into a ulong, values sit inline next to them, probing is linear
+//built on first use and rebuilt only when the font's pair adjustment records change
+public class KerningTable
+{
+    const ulong empty = ulong.MaxValue;
+    static readonly Dictionary<TMP_FontAsset, KerningTable> tables = new Dictionary<TMP_FontAsset, KerningTable>();
+
+    public struct Adjustment
+    {
+        public TMP_GlyphValueRecord first;
+        public TMP_GlyphValueRecord second;
+    }
+
+    struct Slot
+    {
+        public ulong key;
+        public Adjustment adjustment;
+    }
+
+    readonly TMP_FontAsset font;
+    Slot[] slots = new Slot[0];
+    int mask;
+    //64 - log2(capacity), Hash keeps the top bits of the product
+    int shift = 64;
+    int builtFrom = -1;
+
+    public int Count { get; private set; }
+    public int Capacity => slots.Length;
+    //bytes held by the slot array
+    public long Bytes => (long)slots.Length * System.Runtime.InteropServices.Marshal.SizeOf(typeof(Slot));
+
+    KerningTable(TMP_FontAsset font)
+    {
+        this.font = font;
+    }
+
+    public static KerningTable For(TMP_FontAsset font)
+    {
+        KerningTable table;
+        if (!tables.TryGetValue(font, out table))
+        {
+            table = new KerningTable(font);
+            tables.Add(font, table);
+        }
+        return table;
+    }
+
+    //force a rebuild, for when records were edited without changing their number
+    public static void Invalidate(TMP_FontAsset font)
+    {
+        KerningTable table;
+        if (tables.TryGetValue(font, out table))
+        {
+            table.builtFrom = -1;
+        }
+    }
+
+    public static ulong Key(uint firstGlyph, uint secondGlyph)
+    {
+        return (ulong)firstGlyph << 32 | secondGlyph;
+    }
+
+    public bool TryGet(uint firstGlyph, uint secondGlyph, out Adjustment adjustment)
+    {
+        List<TMP_GlyphPairAdjustmentRecord> records = font.fontFeatureTable.glyphPairAdjustmentRecords;
+        if (builtFrom != records.Count)
+        {
+            Build(records);
+        }
+        if (Count > 0)
+        {
+            ulong key = Key(firstGlyph, secondGlyph);
+            int index = Hash(key);
+            while (true)
+            {
+                ulong stored = slots[index].key;
+                if (stored == key)
+                {
+                    adjustment = slots[index].adjustment;
+                    return true;
+                }
+                if (stored == empty)
+                {
+                    break;
+                }
+                index = (index + 1) & mask;
+            }
+        }
+        adjustment = default(Adjustment);
+        return false;
+    }
+
+    void Build(List<TMP_GlyphPairAdjustmentRecord> records)
+    {
+        //at most half full so probes stay short, and at least two slots since a shift of 64 is masked to 0
+        int capacity = 2;
+        while (capacity < records.Count * 2)
+        {
+            capacity <<= 1;
+        }
+        slots = new Slot[capacity];
+        mask = capacity - 1;
+        shift = 64;
+        for (int bits = capacity; bits > 1; bits >>= 1)
+        {
+            shift--;
+        }
+        for (int i = 0; i < capacity; i++)
+        {
+            slots[i].key = empty;
+        }
+        Count = 0;
+        for (int i = 0; i < records.Count; i++)
+        {
+            TMP_GlyphPairAdjustmentRecord record = records[i];
+            ulong key = Key(record.firstAdjustmentRecord.glyphIndex, record.secondAdjustmentRecord.glyphIndex);
+            int index = Hash(key);
+            while (slots[index].key != empty && slots[index].key != key)
+            {
+                index = (index + 1) & mask;
+            }
+            //TMP only adds a pair it does not have yet, so the first record for it wins
+            if (slots[index].key == key)
+            {
+                continue;
+            }
+            Count++;
+            slots[index].key = key;
+            slots[index].adjustment.first = record.firstAdjustmentRecord.glyphValueRecord;
+            slots[index].adjustment.second = record.secondAdjustmentRecord.glyphValueRecord;
+        }
+        builtFrom = records.Count;
+    }
+
+    //fibonacci hashing, spreads packed index pairs well over a power-of-two table
+    int Hash(ulong key)
+    {
+        return (int)((key * 0x9E3779B97F4A7C15UL) >> shift);
+    }
+}
@@ -0,0 +1,178 @@
+using System.Collections.Generic;
+using System.Diagnostics;
+using UnityEngine;
+
+//footprint of a coin or obstacle on the ground plane, world x/z
+public struct LaneItem
+{
+    public float xMin;
+    public float xMax;
+    public float zMin;
+    public float zMax;
+    public PooledObject item;
+    //pool generation at spawn, the item is still this entry's while it matches
+    public int generation;
+    //null for obstacles
+    public Coin coin;
+    public bool obstacle;
+
+    public bool Live => item.live && item.generation == generation;
+}
+
+//gameplay collision without PhysX: the player's swept box against the items of the tiles it is crossing
+//tiles are kept in track order and their items sorted by z, so a step only looks at the current and next tile
+//raises the same events as Coin.OnTriggerEnter, Obstacle.OnTriggerEnter and GroundTile.OnTriggerExit
+public class LaneCollision
+{
+    //set by the simulation harness before the game scene loads
+    public static bool Forced;
+
+    readonly List<GroundTile> track = new List<GroundTile>();
+    int first;
+    RunningStat stepMs;
+
+    //cost of one Step, to compare with the physics step it replaces
+    public RunningStat StepMs => stepMs;
+    public int ItemTests { get; private set; }
+
+    public void Add(GroundTile tile)
+    {
+        track.Add(tile);
+    }
+
+    public void Clear()
+    {
+        track.Clear();
+        first = 0;
+    }
+
+    //moves the player's box from 'from' to 'to', collecting coins on the way
+    //returns where the player ends up, just short of the first obstacle it runs into
+    public Vector3 Step(Vector3 from, Vector3 to, Vector2 halfExtents, SwerveMovement player)
+    {
+        long start = Stopwatch.GetTimestamp();
+        Vector2 origin = new Vector2(from.x, from.z);
+        Vector2 delta = new Vector2(to.x - from.x, to.z - from.z);
+        float sweptMax = Mathf.Max(from.z, to.z) + halfExtents.y;
+
+        //earliest obstacle first, coins only count if they are reached before it
+        float hitTime = float.MaxValue;
+        for (int i = first; i < track.Count; i++)
+        {
+            GroundTile tile = track[i];
+            if (tile == null)
+            {
+                continue;
+            }
+            if (tile.StartZ > sweptMax)
+            {
+                break;
+            }
+            for (int j = 0; j < tile.LaneItemCount; j++)
+            {
+                LaneItem item = tile.GetLaneItem(j);
+                if (item.zMin - halfExtents.y > sweptMax)
+                {
+                    break;
+                }
+                ItemTests++;
+                float time;
+                if (item.obstacle && !player.invulnerable && Enters(item, origin, delta, halfExtents, out time) && time < hitTime)
+                {
+                    hitTime = time;
+                }
+            }
+        }
+        for (int i = first; i < track.Count; i++)
+        {
+            GroundTile tile = track[i];
+            if (tile == null)
+            {
+                continue;
+            }
+            if (tile.StartZ > sweptMax)
+            {
+                break;
+            }
+            for (int j = 0; j < tile.LaneItemCount; j++)
+            {
+                LaneItem item = tile.GetLaneItem(j);
+                if (item.zMin - halfExtents.y > sweptMax)
+                {
+                    break;
+                }
+                ItemTests++;
+                float time;
+                //picked up coins may already be back in the pool or on another tile
+                if (!item.obstacle && item.Live && Enters(item, origin, delta, halfExtents, out time) && time <= hitTime)
+                {
+                    item.coin.Collect();
+                }
+            }
+        }
+
+        Vector3 end = to;
+        if (hitTime < float.MaxValue)
+        {
+            end = from + (to - from) * Mathf.Max(0, hitTime);
+            player.Die();
+        }
+
+        //tiles whose box the player has fully left
+        float back = end.z - halfExtents.y;
+        while (first < track.Count && (track[first] == null || track[first].EndZ < back))
+        {
+            GroundTile tile = track[first];
+            first++;
+            if (tile != null)
+            {
+                tile.Passed();
+            }
+        }
+        if (first > 64)
+        {
+            track.RemoveRange(0, first);
+            first = 0;
+        }
+        stepMs.Add((Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency);
+        return end;
+    }
+
+    //slab test of the moving box against the item grown by the box's half extents
+    static bool Enters(LaneItem item, Vector2 origin, Vector2 delta, Vector2 half, out float time)
+    {
+        float enter = float.MinValue;
+        float exit = float.MaxValue;
+        time = 0;
+        if (!Slab(origin.x, delta.x, item.xMin - half.x, item.xMax + half.x, ref enter, ref exit)
+            || !Slab(origin.y, delta.y, item.zMin - half.y, item.zMax + half.y, ref enter, ref exit))
+        {
+            return false;
+        }
+        if (enter > 1 || exit < 0)
+        {
+            return false;
+        }
+        time = Mathf.Max(0, enter);
+        return true;
+    }
+
+    static bool Slab(float start, float delta, float min, float max, ref float enter, ref float exit)
+    {
+        if (Mathf.Abs(delta) < 1e-6f)
+        {
+            return start > min && start < max;
+        }
+        float t0 = (min - start) / delta;
+        float t1 = (max - start) / delta;
+        if (t0 > t1)
+        {
+            float swap = t0;
+            t0 = t1;
+            t1 = swap;
+        }
+        enter = Mathf.Max(enter, t0);
+        exit = Mathf.Min(exit, t1);
+        return enter <= exit;
+    }
+}
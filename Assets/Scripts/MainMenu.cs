@@ -5,9 +5,23 @@ using UnityEngine.SceneManagement;
 
 public class MainMenu : MonoBehaviour
 {
+    //keep this scene loaded under the next one so Back does not have to load it again
+    [SerializeField] bool keepMenuResident = false;
+
+    //also runs when a resident menu is shown again
+    void OnEnable()
+    {
+        //start loading the game while the menu is on screen
+        int next = SceneManager.GetActiveScene().buildIndex + 1;
+        if (next < SceneManager.sceneCountInBuildSettings)
+        {
+            SceneTransitionManager.Instance.Preload(next, keepMenuResident);
+        }
+    }
+
     public void PlayGame()
     {
-        SceneManager.LoadScene(SceneManager.GetActiveScene().buildIndex + 1);
+        SceneTransitionManager.Instance.Activate(SceneManager.GetActiveScene().buildIndex + 1);
     }
     public void QuitGame()
     {
@@ -15,6 +29,6 @@ public class MainMenu : MonoBehaviour
     }
     public void Back()
     {
-        SceneManager.LoadScene(SceneManager.GetActiveScene().buildIndex - 1);
+        SceneTransitionManager.Instance.Back(SceneManager.GetActiveScene().buildIndex - 1);
     }
 }
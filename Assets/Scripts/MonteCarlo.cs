@@ -0,0 +1,75 @@
+using System;
+using System.Diagnostics;
+using System.Threading.Tasks;
+
+//plays many seeded runs of the run model across all cores
+//runs share nothing but their slot in the outcome array, so throughput grows with the core count
+public static class MonteCarlo
+{
+    //threads <= 0 uses every core
+    public static MonteCarloReport Run(TrackSettings settings, TrackLayout layout, RunRules rules, int runs, ulong baseSeed, int threads)
+    {
+        var outcomes = new RunOutcome[runs];
+        var options = new ParallelOptions();
+        options.MaxDegreeOfParallelism = threads > 0 ? threads : Environment.ProcessorCount;
+        long start = Stopwatch.GetTimestamp();
+        Parallel.For(0, runs, options, i =>
+        {
+            outcomes[i] = RunModel.Simulate(baseSeed + (ulong)i, settings, layout, rules);
+        });
+        double seconds = (Stopwatch.GetTimestamp() - start) / (double)Stopwatch.Frequency;
+
+        var report = new MonteCarloReport();
+        report.runs = runs;
+        report.threads = options.MaxDegreeOfParallelism;
+        report.baseSeed = baseSeed;
+        report.tallObstacleChance = settings.tallObstacleChance;
+        report.coinChance = settings.coinChance;
+        report.speedPerCoin = rules.speedPerCoin;
+        report.lateralSpeed = rules.lateralSpeed;
+        report.reactionTime = rules.reactionTime;
+        report.wallSeconds = seconds;
+        if (runs == 0)
+        {
+            return report;
+        }
+
+        var distances = new float[runs];
+        double totalDistance = 0;
+        double totalCoins = 0;
+        double totalSpeed = 0;
+        for (int i = 0; i < runs; i++)
+        {
+            RunOutcome outcome = outcomes[i];
+            distances[i] = outcome.distance;
+            totalDistance += outcome.distance;
+            totalCoins += outcome.coins;
+            totalSpeed += outcome.finalSpeed;
+            switch (outcome.end)
+            {
+                case RunEnd.Survived:
+                    report.survived++;
+                    break;
+                case RunEnd.FirstObstacle:
+                    report.firstObstacleDeaths++;
+                    break;
+                case RunEnd.TallObstacle:
+                    report.tallObstacleDeaths++;
+                    break;
+                case RunEnd.SecondObstacle:
+                    report.secondObstacleDeaths++;
+                    break;
+            }
+        }
+        Array.Sort(distances);
+        report.simulatedKm = totalDistance / 1000;
+        report.kmPerSecond = seconds > 0 ? report.simulatedKm / seconds : 0;
+        report.meanDistance = totalDistance / runs;
+        report.p50Distance = distances[(runs - 1) / 2];
+        report.p95Distance = distances[(int)((runs - 1) * 0.95)];
+        report.maxDistance = distances[runs - 1];
+        report.meanCoins = totalCoins / runs;
+        report.meanFinalSpeed = totalSpeed / runs;
+        return report;
+    }
+}
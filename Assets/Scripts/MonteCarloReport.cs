@@ -0,0 +1,30 @@
+using System;
+
+//aggregate of a batch of model runs, written out with JsonUtility
+[Serializable]
+public class MonteCarloReport
+{
+    public int runs;
+    public int threads;
+    public ulong baseSeed;
+    public float tallObstacleChance;
+    public float coinChance;
+    public float speedPerCoin;
+    public float lateralSpeed;
+    public float reactionTime;
+
+    public double wallSeconds;
+    public double simulatedKm;
+    public double kmPerSecond;
+
+    public double meanDistance;
+    public double p50Distance;
+    public double p95Distance;
+    public double maxDistance;
+    public double meanCoins;
+    public double meanFinalSpeed;
+    public int survived;
+    public int firstObstacleDeaths;
+    public int tallObstacleDeaths;
+    public int secondObstacleDeaths;
+}
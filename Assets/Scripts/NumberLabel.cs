@@ -0,0 +1,53 @@
+//"prefix + number" strings for UI Text, built without String.Concat or Int32.ToString
+//values below prewarm are formatted up front, anything higher the first time it is asked for, and reused from then on
+public class NumberLabel
+{
+    readonly string prefix;
+    readonly char[] buffer;
+    string[] cache;
+
+    public NumberLabel(string prefix, int prewarm)
+    {
+        this.prefix = prefix;
+        buffer = new char[prefix.Length + 11];
+        prefix.CopyTo(0, buffer, 0, prefix.Length);
+        cache = new string[System.Math.Max(prewarm, 1)];
+        for (int i = 0; i < prewarm; i++)
+        {
+            cache[i] = Format(i);
+        }
+    }
+
+    public string Get(int value)
+    {
+        if (value < 0)
+        {
+            return Format(value);
+        }
+        if (value >= cache.Length)
+        {
+            System.Array.Resize(ref cache, System.Math.Max(value + 1, cache.Length * 2));
+        }
+        return cache[value] ?? (cache[value] = Format(value));
+    }
+
+    string Format(int value)
+    {
+        int length = prefix.Length;
+        long remaining = value;
+        if (remaining < 0)
+        {
+            buffer[length++] = '-';
+            remaining = -remaining;
+        }
+        int start = length;
+        do
+        {
+            buffer[length++] = (char)('0' + remaining % 10);
+            remaining /= 10;
+        }
+        while (remaining > 0);
+        System.Array.Reverse(buffer, start, length - start);
+        return new string(buffer, 0, length);
+    }
+}
@@ -0,0 +1,64 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+//prefab keyed pools for everything spawned onto ground tiles
+public static class ObjectPools
+{
+    static readonly Dictionary<GameObject, PrefabPool> pools = new Dictionary<GameObject, PrefabPool>();
+    static Transform root;
+
+    public static Dictionary<GameObject, PrefabPool>.ValueCollection All => pools.Values;
+
+    //make sure the pool for prefab holds at least count instances and can grow up to maxSize
+    public static PrefabPool Prewarm(GameObject prefab, int count, int maxSize)
+    {
+        PrefabPool pool = Get(prefab);
+        pool.MaxSize = Mathf.Max(pool.MaxSize, maxSize);
+        pool.Prewarm(count);
+        return pool;
+    }
+
+    public static PooledObject Spawn(GameObject prefab, Transform parent)
+    {
+        return Get(prefab).Spawn(parent);
+    }
+
+    public static PooledObject Spawn(GameObject prefab, Vector3 position, Quaternion rotation, Transform parent)
+    {
+        return Get(prefab).Spawn(position, rotation, parent);
+    }
+
+    //returns pooled instances, destroys anything that came from overflow or outside the pools
+    public static void Despawn(GameObject go)
+    {
+        PooledObject item = go.GetComponent<PooledObject>();
+        if (item != null)
+        {
+            item.Despawn();
+        }
+        else
+        {
+            GameplayCounters.Destroys++;
+            Object.Destroy(go);
+        }
+    }
+
+    public static PrefabPool Get(GameObject prefab)
+    {
+        //the root goes away with the scene, and with it every free instance
+        if (root == null)
+        {
+            pools.Clear();
+            root = new GameObject("ObjectPools").transform;
+            //free instances sit under an inactive root so prewarming never runs Awake or OnEnable
+            root.gameObject.SetActive(false);
+        }
+        PrefabPool pool;
+        if (!pools.TryGetValue(prefab, out pool))
+        {
+            pool = new PrefabPool(prefab, root, 0);
+            pools.Add(prefab, pool);
+        }
+        return pool;
+    }
+}
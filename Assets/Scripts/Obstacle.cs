@@ -8,14 +8,16 @@ public class Obstacle : MonoBehaviour
 
     void Start()
     {
-        playerMovement = GameObject.FindObjectOfType<SwerveMovement>();
+        playerMovement = Services.Get<SwerveMovement>();
 
     }
 
-    void OnCollisionEnter (Collision collision)
+    //obstacles are triggers, the kinematic player gets trigger events from them without any contact pairs
+    void OnTriggerEnter (Collider other)
     {
+        GameplayCounters.TriggerCallbacks++;
         //killing player
-        if (collision.gameObject.name == "Player")
+        if (other.gameObject.layer == EntityLayers.Player)
         {
             playerMovement.Die();
         }
@@ -19,5 +19,6 @@ public class Paused : MonoBehaviour
         pauseMenuButton.SetActive(true);
         Time.timeScale = 0f;
         GamePaused = true;
+        GameManager.inst.SaveHighScore();
     }
 }
@@ -0,0 +1,24 @@
+using UnityEngine;
+
+//added to every instance handed out by a PrefabPool
+public class PooledObject : MonoBehaviour
+{
+    [System.NonSerialized] public PrefabPool pool;
+    [System.NonSerialized] public bool live;
+    //bumped on every despawn, a holder that saved it can tell its spawn from a later reuse
+    [System.NonSerialized] public int generation;
+    //made past the pool's MaxSize, destroyed on despawn
+    [System.NonSerialized] public bool overflow;
+    //looked up once when the pool makes the instance, null on anything that is not a coin
+    [System.NonSerialized] public Coin coin;
+
+    public void Despawn()
+    {
+        pool.Despawn(this);
+    }
+
+    void OnDestroy()
+    {
+        pool.Forget(this);
+    }
+}
@@ -0,0 +1,160 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+//free list of instances of a single prefab
+//instances are created under the inactive pool root, so nothing on them wakes up until the first Spawn
+public class PrefabPool
+{
+    readonly GameObject prefab;
+    readonly Transform root;
+    readonly Stack<PooledObject> free = new Stack<PooledObject>();
+
+    public GameObject Prefab => prefab;
+    public int MaxSize { get; set; }
+    public int Live { get; private set; }
+    public int Free => free.Count;
+    public int Peak { get; private set; }
+    public int Created { get; private set; }
+    //spawns refused by MaxSize and handed out as plain instances
+    public int Overflow { get; private set; }
+
+    public PrefabPool(GameObject prefab, Transform root, int maxSize)
+    {
+        this.prefab = prefab;
+        this.root = root;
+        MaxSize = maxSize;
+    }
+
+    public void Prewarm(int count)
+    {
+        while (Created < count && Created < MaxSize)
+        {
+            free.Push(Create());
+        }
+    }
+
+    //spawn with the prefab's own local pose under parent
+    public PooledObject Spawn(Transform parent)
+    {
+        Transform source = prefab.transform;
+        PooledObject item = Take();
+        if (item == null)
+        {
+            return Overflowed(Object.Instantiate(prefab, parent));
+        }
+        Transform t = item.transform;
+        t.SetParent(parent, false);
+        t.localPosition = source.localPosition;
+        t.localRotation = source.localRotation;
+        return Activate(item);
+    }
+
+    public PooledObject Spawn(Vector3 position, Quaternion rotation, Transform parent)
+    {
+        PooledObject item = Take();
+        if (item == null)
+        {
+            return Overflowed(Object.Instantiate(prefab, position, rotation, parent));
+        }
+        Transform t = item.transform;
+        t.SetParent(parent, false);
+        t.position = position;
+        t.rotation = rotation;
+        return Activate(item);
+    }
+
+    public void Despawn(PooledObject item)
+    {
+        if (!item.live)
+        {
+            return;
+        }
+        item.live = false;
+        item.generation++;
+        if (item.overflow)
+        {
+            GameplayCounters.Destroys++;
+            Object.Destroy(item.gameObject);
+            return;
+        }
+        Live--;
+        item.gameObject.SetActive(false);
+        item.transform.SetParent(root, false);
+        free.Push(item);
+    }
+
+    //a live instance was destroyed together with its parent
+    public void Forget(PooledObject item)
+    {
+        if (item.overflow)
+        {
+            item.live = false;
+            return;
+        }
+        Created--;
+        if (item.live)
+        {
+            item.live = false;
+            Live--;
+        }
+    }
+
+    PooledObject Take()
+    {
+        if (free.Count > 0)
+        {
+            return free.Pop();
+        }
+        if (Created < MaxSize)
+        {
+            return Create();
+        }
+        return null;
+    }
+
+    PooledObject Create()
+    {
+        GameplayCounters.Instantiates++;
+        //the root is inactive, the instance only wakes up when Activate moves it out
+        GameObject go = Object.Instantiate(prefab, root, false);
+        go.SetActive(false);
+        PooledObject item = Attach(go);
+        Created++;
+        return item;
+    }
+
+    PooledObject Activate(PooledObject item)
+    {
+        item.live = true;
+        Live++;
+        if (Live > Peak)
+        {
+            Peak = Live;
+        }
+        item.gameObject.SetActive(true);
+        return item;
+    }
+
+    PooledObject Attach(GameObject go)
+    {
+        PooledObject item = go.AddComponent<PooledObject>();
+        item.pool = this;
+        item.coin = go.GetComponent<Coin>();
+        if (item.coin != null)
+        {
+            item.coin.pooled = item;
+        }
+        return item;
+    }
+
+    //a plain instance past MaxSize, destroyed instead of returned on despawn
+    PooledObject Overflowed(GameObject go)
+    {
+        Overflow++;
+        GameplayCounters.Instantiates++;
+        PooledObject item = Attach(go);
+        item.overflow = true;
+        item.live = true;
+        return item;
+    }
+}
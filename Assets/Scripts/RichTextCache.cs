@@ -0,0 +1,269 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+//markup compiled once into plain text plus colour runs, kept in a bounded LRU
+//only <color=#rgb[a]>, <color=#rrggbb[aa]>, <color=name>, </color> and <alpha=#aa> compile; anything else is cached
+//as not compilable so the caller hands that string to TMP's own parser
+//colours follow TMP: <alpha> only changes the current colour's alpha, and </color> goes back to the colour pushed
+//before it, or to the label colour when the stack is empty
+public static class RichTextCache
+{
+    public struct ColorRun
+    {
+        public int start;
+        public int length;
+        public Color32 color;
+        //the run keeps the label's own rgb and only takes color.a, for <alpha> outside any colour tag
+        public bool labelColor;
+    }
+
+    public class Compiled
+    {
+        public string markup;
+        //null when the markup uses tags that only TMP can handle
+        public string plain;
+        public ColorRun[] runs;
+        public int bytes;
+    }
+
+    static readonly Dictionary<long, LinkedListNode<Compiled>> entries = new Dictionary<long, LinkedListNode<Compiled>>();
+    static readonly LinkedList<Compiled> recent = new LinkedList<Compiled>();
+    static readonly List<ColorRun> runBuffer = new List<ColorRun>();
+    static readonly List<Color32> colorStack = new List<Color32>();
+    static Color32 currentColor;
+    static bool currentIsLabel;
+    //the named colours TMP understands
+    static readonly string[] colorNames = { "red", "green", "blue", "white", "black", "yellow", "orange", "purple" };
+    static readonly Color32[] namedColors =
+    {
+        new Color32(255, 0, 0, 255), new Color32(0, 255, 0, 255), new Color32(0, 0, 255, 255), new Color32(255, 255, 255, 255),
+        new Color32(0, 0, 0, 255), new Color32(255, 255, 0, 255), new Color32(255, 128, 0, 255), new Color32(160, 32, 240, 255)
+    };
+    static readonly System.Text.StringBuilder plainBuffer = new System.Text.StringBuilder(128);
+
+    public static int MaxEntries = 128;
+    public static int MaxBytes = 64 * 1024;
+    //bump when style sheets change so nothing compiled against the old ones is reused
+    public static int StyleSheetVersion { get; private set; }
+    public static int Hits { get; private set; }
+    public static int Misses { get; private set; }
+    public static int Bytes { get; private set; }
+    public static int Count => entries.Count;
+    public static float HitRate => Hits + Misses == 0 ? 0 : Hits / (float)(Hits + Misses);
+
+    public static void InvalidateStyles()
+    {
+        StyleSheetVersion++;
+        Clear();
+    }
+
+    public static void Clear()
+    {
+        entries.Clear();
+        recent.Clear();
+        Bytes = 0;
+    }
+
+    public static Compiled Get(string markup)
+    {
+        long key = (long)markup.GetHashCode() << 32 | (uint)StyleSheetVersion;
+        LinkedListNode<Compiled> node;
+        if (entries.TryGetValue(key, out node) && node.Value.markup == markup)
+        {
+            Hits++;
+            recent.Remove(node);
+            recent.AddFirst(node);
+            return node.Value;
+        }
+        Misses++;
+        if (node != null)
+        {
+            Remove(key, node);
+        }
+        Compiled compiled = Compile(markup);
+        node = recent.AddFirst(compiled);
+        entries.Add(key, node);
+        Bytes += compiled.bytes;
+        while (entries.Count > MaxEntries || (Bytes > MaxBytes && entries.Count > 1))
+        {
+            LinkedListNode<Compiled> last = recent.Last;
+            Remove((long)last.Value.markup.GetHashCode() << 32 | (uint)StyleSheetVersion, last);
+        }
+        return compiled;
+    }
+
+    static void Remove(long key, LinkedListNode<Compiled> node)
+    {
+        entries.Remove(key);
+        recent.Remove(node);
+        Bytes -= node.Value.bytes;
+    }
+
+    static Compiled Compile(string markup)
+    {
+        var compiled = new Compiled();
+        compiled.markup = markup;
+        plainBuffer.Length = 0;
+        runBuffer.Clear();
+        colorStack.Clear();
+        ResetToLabel();
+        int runStart = 0;
+        bool compilable = true;
+        for (int i = 0; i < markup.Length && compilable; i++)
+        {
+            char c = markup[i];
+            int close = c == '<' ? markup.IndexOf('>', i) : -1;
+            if (close < 0)
+            {
+                plainBuffer.Append(c);
+                continue;
+            }
+            //a tag changes the colour, close the run of the colour before it
+            CloseRun(runStart);
+            runStart = plainBuffer.Length;
+            compilable = ApplyTag(markup, i + 1, close - i - 1);
+            i = close;
+        }
+        if (compilable)
+        {
+            CloseRun(runStart);
+        }
+        //string header plus chars, for both strings, and the run array
+        compiled.bytes = 26 + markup.Length * 2;
+        if (compilable)
+        {
+            compiled.plain = plainBuffer.ToString();
+            compiled.runs = runBuffer.ToArray();
+            compiled.bytes += 26 + compiled.plain.Length * 2 + 24 + compiled.runs.Length * 16;
+        }
+        return compiled;
+    }
+
+    static void CloseRun(int runStart)
+    {
+        //plain label colour needs no run, TMP already writes it with rich text off
+        if (plainBuffer.Length == runStart || (currentIsLabel && currentColor.a == 255))
+        {
+            return;
+        }
+        runBuffer.Add(new ColorRun { start = runStart, length = plainBuffer.Length - runStart, color = currentColor, labelColor = currentIsLabel });
+    }
+
+    static void ResetToLabel()
+    {
+        currentColor = new Color32(255, 255, 255, 255);
+        currentIsLabel = true;
+    }
+
+    static bool ApplyTag(string markup, int start, int length)
+    {
+        if (Matches(markup, start, length, "/color"))
+        {
+            if (colorStack.Count > 0)
+            {
+                colorStack.RemoveAt(colorStack.Count - 1);
+            }
+            if (colorStack.Count > 0)
+            {
+                currentColor = colorStack[colorStack.Count - 1];
+                currentIsLabel = false;
+            }
+            else
+            {
+                ResetToLabel();
+            }
+            return true;
+        }
+        Color32 color;
+        if (StartsWith(markup, start, length, "color=") && TryColor(markup, start + 6, length - 6, out color))
+        {
+            colorStack.Add(color);
+            currentColor = color;
+            currentIsLabel = false;
+            return true;
+        }
+        if (StartsWith(markup, start, length, "alpha=#") && length == 9)
+        {
+            int alpha = Hex(markup, start + 7, 2);
+            if (alpha < 0)
+            {
+                return false;
+            }
+            currentColor.a = (byte)alpha;
+            return true;
+        }
+        return false;
+    }
+
+    static bool TryColor(string markup, int start, int length, out Color32 color)
+    {
+        color = new Color32(255, 255, 255, 255);
+        if (length > 0 && markup[start] == '#')
+        {
+            int r, g, b, a;
+            if (length == 4 || length == 5)
+            {
+                //#rgb and #rgba repeat each digit, #f80 is #ff8800
+                r = Hex(markup, start + 1, 1) * 17;
+                g = Hex(markup, start + 2, 1) * 17;
+                b = Hex(markup, start + 3, 1) * 17;
+                a = length == 5 ? Hex(markup, start + 4, 1) * 17 : 255;
+            }
+            else if (length == 7 || length == 9)
+            {
+                r = Hex(markup, start + 1, 2);
+                g = Hex(markup, start + 3, 2);
+                b = Hex(markup, start + 5, 2);
+                a = length == 9 ? Hex(markup, start + 7, 2) : 255;
+            }
+            else
+            {
+                return false;
+            }
+            if (r < 0 || g < 0 || b < 0 || a < 0)
+            {
+                return false;
+            }
+            color = new Color32((byte)r, (byte)g, (byte)b, (byte)a);
+            return true;
+        }
+        for (int i = 0; i < colorNames.Length; i++)
+        {
+            if (Matches(markup, start, length, colorNames[i]))
+            {
+                color = namedColors[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static int Hex(string markup, int start, int digits)
+    {
+        int value = 0;
+        for (int i = 0; i < digits; i++)
+        {
+            char c = markup[start + i];
+            int digit = c >= '0' && c <= '9' ? c - '0'
+                : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                : -1;
+            if (digit < 0)
+            {
+                return -1;
+            }
+            value = value * 16 + digit;
+        }
+        return value;
+    }
+
+    static bool Matches(string markup, int start, int length, string tag)
+    {
+        return length == tag.Length && string.CompareOrdinal(markup, start, tag, 0, length) == 0;
+    }
+
+    static bool StartsWith(string markup, int start, int length, string prefix)
+    {
+        return length >= prefix.Length && string.CompareOrdinal(markup, start, prefix, 0, prefix.Length) == 0;
+    }
+}
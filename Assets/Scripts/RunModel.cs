@@ -0,0 +1,168 @@
+using UnityEngine;
+
+//everything about a run that is not the track: the player's speed, reach and steering
+public struct RunRules
+{
+    public float startSpeed;
+    public float speedPerCoin;
+    public float maxPositionX;
+    public float playerRadius;
+    //stand-in for a player, how fast it moves sideways and how long it takes to react to what is ahead
+    public float lateralSpeed;
+    public float reactionTime;
+    //runs that get this far are stopped and counted as survived
+    public float maxDistance;
+}
+
+public enum RunEnd : byte
+{
+    Survived,
+    FirstObstacle,
+    TallObstacle,
+    SecondObstacle
+}
+
+public struct RunOutcome
+{
+    public float distance;
+    public int coins;
+    public float finalSpeed;
+    public RunEnd end;
+}
+
+//the game's track and collision rules without any MonoBehaviour, so runs can be played off the main thread
+//tiles come from TrackGenerator.Generate, so a seed lays out the same track as it does in the game
+public static class RunModel
+{
+    const byte firstObstacle = 0;
+    const byte secondObstacle = 1;
+    const byte coin = 2;
+    const byte tallObstacle = 3;
+
+    struct Item
+    {
+        public Vector2 position;
+        public byte kind;
+    }
+
+    public static RunOutcome Simulate(ulong seed, TrackSettings settings, TrackLayout layout, RunRules rules)
+    {
+        var random = new TrackRandom(seed);
+        var items = new Item[2 + TrackChunk.CoinCount];
+        RunOutcome outcome = default;
+        float speed = rules.startSpeed;
+        float x = 0;
+        float z = 0;
+        //the first two tiles are laid without items
+        float tileZ = 2 * layout.length;
+        while (tileZ < rules.maxDistance)
+        {
+            TrackChunk chunk = TrackGenerator.Generate(ref random, settings);
+            int count = Collect(chunk, layout, items);
+            for (int i = 0; i < count; i++)
+            {
+                Item item = items[i];
+                float itemZ = tileZ + item.position.y;
+                //sideways distance the player can cover before reaching the item
+                float reach = Mathf.Max(0, (itemZ - z) / speed - rules.reactionTime) * rules.lateralSpeed;
+                z = itemZ;
+                if (item.kind == coin)
+                {
+                    float gap = Mathf.Abs(item.position.x - x) - layout.coinRadius - rules.playerRadius;
+                    if (gap <= reach)
+                    {
+                        x = Mathf.MoveTowards(x, item.position.x, Mathf.Max(0, gap));
+                        outcome.coins++;
+                        speed += rules.speedPerCoin;
+                    }
+                    continue;
+                }
+                Vector2 footprint = item.kind == firstObstacle ? layout.firstFootprint
+                    : item.kind == tallObstacle ? layout.tallFootprint
+                    : layout.secondFootprint;
+                if (!Dodge(ref x, item.position.x, footprint.x + rules.playerRadius, reach, rules.maxPositionX))
+                {
+                    outcome.distance = z;
+                    outcome.finalSpeed = speed;
+                    outcome.end = item.kind == firstObstacle ? RunEnd.FirstObstacle
+                        : item.kind == tallObstacle ? RunEnd.TallObstacle
+                        : RunEnd.SecondObstacle;
+                    return outcome;
+                }
+            }
+            tileZ += layout.length;
+        }
+        outcome.distance = tileZ;
+        outcome.finalSpeed = speed;
+        outcome.end = RunEnd.Survived;
+        return outcome;
+    }
+
+    //the tile's obstacles and the coins GroundTile would place, sorted front to back
+    static int Collect(TrackChunk chunk, TrackLayout layout, Item[] items)
+    {
+        Vector2 first = layout.firstObstacle[chunk.firstObstacleLane];
+        Vector2 second = layout.secondObstacle[chunk.secondObstacleLane];
+        //same choice GroundTile.SpawnObstacle makes for the first anchor
+        Vector2 firstFootprint = chunk.tallRoll ? layout.tallFootprint : layout.firstFootprint;
+        int count = 0;
+        items[count++] = new Item { position = first, kind = chunk.tallRoll ? tallObstacle : firstObstacle };
+        items[count++] = new Item { position = second, kind = secondObstacle };
+        for (int i = 0; i < TrackChunk.CoinCount; i++)
+        {
+            Vector2 slot = layout.coinSlots[chunk.CoinSlot(i)];
+            if (!chunk.HasCoin(i)
+                || Overlaps(slot, first, firstFootprint, layout.coinRadius)
+                || Overlaps(slot, second, layout.secondFootprint, layout.coinRadius))
+            {
+                continue;
+            }
+            items[count++] = new Item { position = slot, kind = coin };
+        }
+        for (int i = 1; i < count; i++)
+        {
+            Item item = items[i];
+            int j = i - 1;
+            while (j >= 0 && items[j].position.y > item.position.y)
+            {
+                items[j + 1] = items[j];
+                j--;
+            }
+            items[j + 1] = item;
+        }
+        return count;
+    }
+
+    //steps to the nearer side of a blocked band if there is room and time, false when the player hits it
+    static bool Dodge(ref float x, float center, float half, float reach, float maxX)
+    {
+        if (Mathf.Abs(x - center) >= half)
+        {
+            return true;
+        }
+        float left = center - half;
+        float right = center + half;
+        float best = float.MaxValue;
+        if (left >= -maxX)
+        {
+            best = left;
+        }
+        if (right <= maxX && Mathf.Abs(right - x) < Mathf.Abs(best - x))
+        {
+            best = right;
+        }
+        if (Mathf.Abs(best - x) > reach)
+        {
+            return false;
+        }
+        x = best;
+        return true;
+    }
+
+    //same rule GroundTile uses to keep coins out of obstacles
+    static bool Overlaps(Vector2 coin, Vector2 obstacle, Vector2 footprint, float coinRadius)
+    {
+        return Mathf.Abs(coin.x - obstacle.x) < footprint.x + coinRadius
+            && Mathf.Abs(coin.y - obstacle.y) < footprint.y + coinRadius;
+    }
+}
@@ -0,0 +1,38 @@
+using System;
+
+//streaming mean / variance (Welford), cheap enough to feed every frame
+public struct RunningStat
+{
+    int count;
+    double mean;
+    double m2;
+    double max;
+
+    public int Count => count;
+    public double Mean => mean;
+    public double Variance => count > 1 ? m2 / (count - 1) : 0;
+    public double StdDev => Math.Sqrt(Variance);
+    public double Max => max;
+
+    public void Add(double value)
+    {
+        count++;
+        double delta = value - mean;
+        mean += delta / count;
+        m2 += delta * (value - mean);
+        if (count == 1 || value > max)
+        {
+            max = value;
+        }
+    }
+
+    public void Clear()
+    {
+        this = default(RunningStat);
+    }
+
+    public override string ToString()
+    {
+        return string.Format("n {0} mean {1:F4} sd {2:F4} max {3:F4}", count, mean, StdDev, max);
+    }
+}
@@ -0,0 +1,152 @@
+using System.Collections.Generic;
+using System.Diagnostics;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+
+//loads the next scene in the background while the current one is showing, and activates it on request
+//optionally keeps the menu loaded underneath the game so going back is instant
+public class SceneTransitionManager : MonoBehaviour
+{
+    static SceneTransitionManager inst;
+    AsyncOperation pending;
+    int pendingIndex = -1;
+    bool pendingAdditive;
+    //preload asked for while another load was in flight, started once that scene has loaded
+    int queuedIndex = -1;
+    bool queuedAdditive;
+    long preloadStart;
+    long activateStart;
+    //menu scene kept loaded but hidden while the game runs on top of it
+    Scene residentScene;
+    readonly List<GameObject> residentRoots = new List<GameObject>();
+
+    public static SceneTransitionManager Instance
+    {
+        get
+        {
+            if (inst == null)
+            {
+                inst = new GameObject("SceneTransitionManager").AddComponent<SceneTransitionManager>();
+                DontDestroyOnLoad(inst.gameObject);
+            }
+            return inst;
+        }
+    }
+
+    //0..1 over the part of the load that runs before activation
+    public float Progress => pending == null ? 0 : Mathf.Clamp01(pending.progress / 0.9f);
+    public bool Ready => pending != null && pending.progress >= 0.9f;
+    //time from Preload until the scene was ready to activate
+    public double PreloadMs { get; private set; }
+    //time from Activate until the scene finished loading
+    public double TimeToActivationMs { get; private set; }
+
+    void Awake()
+    {
+        SceneManager.sceneLoaded += OnSceneLoaded;
+    }
+
+    void OnDestroy()
+    {
+        SceneManager.sceneLoaded -= OnSceneLoaded;
+    }
+
+    public void Preload(int buildIndex, bool keepCurrentResident)
+    {
+        if (pending != null)
+        {
+            //the menu asks for the game from OnEnable before sceneLoaded has cleared the menu's own load
+            if (buildIndex != pendingIndex)
+            {
+                queuedIndex = buildIndex;
+                queuedAdditive = keepCurrentResident;
+            }
+            return;
+        }
+        pendingIndex = buildIndex;
+        pendingAdditive = keepCurrentResident;
+        preloadStart = Stopwatch.GetTimestamp();
+        PreloadMs = 0;
+        pending = SceneManager.LoadSceneAsync(buildIndex, keepCurrentResident ? LoadSceneMode.Additive : LoadSceneMode.Single);
+        pending.allowSceneActivation = false;
+    }
+
+    public void Activate(int buildIndex)
+    {
+        if (pending == null || pendingIndex != buildIndex)
+        {
+            //nothing preloaded for this scene, load it the normal way but still without blocking
+            Preload(buildIndex, false);
+        }
+        activateStart = Stopwatch.GetTimestamp();
+        pending.allowSceneActivation = true;
+    }
+
+    public void Back(int buildIndex)
+    {
+        if (residentScene.IsValid() && residentScene.isLoaded && residentScene.buildIndex == buildIndex)
+        {
+            Scene current = SceneManager.GetActiveScene();
+            Scene menu = residentScene;
+            residentScene = default(Scene);
+            SceneManager.SetActiveScene(menu);
+            SceneManager.UnloadSceneAsync(current);
+            for (int i = 0; i < residentRoots.Count; i++)
+            {
+                if (residentRoots[i] != null)
+                {
+                    residentRoots[i].SetActive(true);
+                }
+            }
+            residentRoots.Clear();
+            return;
+        }
+        Activate(buildIndex);
+    }
+
+    void Update()
+    {
+        if (pending != null && PreloadMs == 0 && pending.progress >= 0.9f)
+        {
+            PreloadMs = ElapsedMs(preloadStart);
+        }
+    }
+
+    void OnSceneLoaded(Scene scene, LoadSceneMode mode)
+    {
+        if (pending == null || scene.buildIndex != pendingIndex)
+        {
+            return;
+        }
+        TimeToActivationMs = ElapsedMs(activateStart);
+        pending = null;
+        pendingIndex = -1;
+        if (pendingAdditive)
+        {
+            //hide the scene we came from instead of unloading it
+            residentScene = SceneManager.GetActiveScene();
+            residentScene.GetRootGameObjects(residentRoots);
+            for (int i = residentRoots.Count - 1; i >= 0; i--)
+            {
+                if (!residentRoots[i].activeSelf)
+                {
+                    residentRoots.RemoveAt(i);
+                    continue;
+                }
+                residentRoots[i].SetActive(false);
+            }
+            SceneManager.SetActiveScene(scene);
+        }
+        if (queuedIndex >= 0)
+        {
+            int index = queuedIndex;
+            queuedIndex = -1;
+            Preload(index, queuedAdditive);
+        }
+    }
+
+    static double ElapsedMs(long start)
+    {
+        return (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+    }
+}
@@ -0,0 +1,40 @@
+using UnityEngine;
+
+//scene-wide objects register here on Awake so spawned objects can find them without scanning the scene
+public static class Services
+{
+    static class Slot<T> where T : Object
+    {
+        public static T instance;
+    }
+
+    //FindObjectOfType fallbacks taken so far; should stay flat once gameplay has started
+    public static int FindCalls { get; private set; }
+    public static bool GameplayActive { get; set; }
+
+    public static void Register<T>(T service) where T : Object
+    {
+        Slot<T>.instance = service;
+    }
+
+    public static void Unregister<T>(T service) where T : Object
+    {
+        if (Slot<T>.instance == service)
+        {
+            Slot<T>.instance = null;
+        }
+    }
+
+    public static T Get<T>() where T : Object
+    {
+        T service = Slot<T>.instance;
+        if (service == null)
+        {
+            FindCalls++;
+            Debug.Assert(!GameplayActive, "Services: " + typeof(T).Name + " was not registered, falling back to FindObjectOfType during gameplay");
+            service = Object.FindObjectOfType<T>();
+            Slot<T>.instance = service;
+        }
+        return service;
+    }
+}
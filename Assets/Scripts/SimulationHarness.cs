@@ -0,0 +1,396 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using Unity.Profiling;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+
+//runs the real game scene for a set distance at a scripted speed and writes a json report, no input or GPU needed
+//player -batchmode -nographics -simulate [-simulateKm 5] [-simulateSpeed 6,20,40] [-simulateFps 60]
+//                                        [-simulateReport report.json] [-simulateTimeout 600] [-analyticCollision]
+//the process exits with 0 when the distance was covered and 1 when it timed out
+//-measureMotion times the player's physics step and frame judder in its configured motion mode
+//-motionBenchmark covers the distance once per SwerveMovement.MotionMode, restarting in place between them
+//-pacerBenchmark holds every frame to -simulateFps with FramePacer and reports its intervals and wait cost
+//-textBenchmark N times N counter updates through a full TMP rebuild and through IncrementalText
+//-simulateRuns N skips playing and instead runs N seeded runs of the run model across all cores
+//  [-simulateThreads 0] [-simulateSeed 1] [-tallChance f] [-coinChance f] [-speedPerCoin f]
+//  [-botLateralSpeed 12] [-botReaction 0.25], -simulateKm caps each run
+public class SimulationHarness : MonoBehaviour
+{
+    const int gameScene = 1;
+    float kilometres = 5;
+    //speeds spread evenly over the run and interpolated in between
+    float[] speedProfile = { 6, 40 };
+    int frameRate = 60;
+    string reportPath = "simulation-report.json";
+    float timeoutSeconds = 600;
+    int textBenchmarkUpdates;
+    int monteCarloRuns;
+    int monteCarloThreads;
+    ulong monteCarloSeed = 1;
+    //negative keeps the prefab's value
+    float tallChance = -1;
+    float coinChance = -1;
+    float speedPerCoin = -1;
+    float botLateralSpeed = 12;
+    float botReaction = 0.25f;
+    bool pacerBenchmark;
+    bool measureMotion;
+    bool motionBenchmark;
+
+    SwerveMovement player;
+    GroundSpawner spawner;
+    FloatingOrigin floatingOrigin;
+    readonly FrameIntervalHistogram frameMs = new FrameIntervalHistogram();
+    static readonly SwerveMovement.MotionMode[] motionModes = { SwerveMovement.MotionMode.Transform, SwerveMovement.MotionMode.KinematicRigidbody };
+    readonly List<MotionRunReport> motionRuns = new List<MotionRunReport>();
+    int motionMode;
+    FramePacer pacer;
+    TimeSpan cpuStart;
+    ProfilerRecorder gcRecorder;
+    ProfilerRecorder physicsRecorder;
+    long gcBytes;
+    long physicsNs;
+    long lastFrame;
+    long runStart;
+    float startDistance;
+    int maxLiveTiles;
+    bool running;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+    static void Bootstrap()
+    {
+        string[] args = Environment.GetCommandLineArgs();
+        if (Array.IndexOf(args, "-simulate") < 0)
+        {
+            return;
+        }
+        var harness = new GameObject("SimulationHarness").AddComponent<SimulationHarness>();
+        harness.ReadArguments(args);
+        DontDestroyOnLoad(harness.gameObject);
+    }
+
+    void ReadArguments(string[] args)
+    {
+        for (int i = 0; i < args.Length - 1; i++)
+        {
+            string value = args[i + 1];
+            switch (args[i])
+            {
+                case "-simulateKm":
+                    kilometres = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-simulateSpeed":
+                    string[] parts = value.Split(',');
+                    speedProfile = new float[parts.Length];
+                    for (int p = 0; p < parts.Length; p++)
+                    {
+                        speedProfile[p] = float.Parse(parts[p], CultureInfo.InvariantCulture);
+                    }
+                    break;
+                case "-simulateFps":
+                    frameRate = int.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-simulateReport":
+                    reportPath = value;
+                    break;
+                case "-simulateTimeout":
+                    timeoutSeconds = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-measureMotion":
+                    measureMotion = true;
+                    break;
+                case "-motionBenchmark":
+                    measureMotion = true;
+                    motionBenchmark = true;
+                    break;
+                case "-pacerBenchmark":
+                    pacerBenchmark = true;
+                    break;
+                case "-analyticCollision":
+                    LaneCollision.Forced = true;
+                    break;
+                case "-textBenchmark":
+                    textBenchmarkUpdates = int.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-simulateRuns":
+                    monteCarloRuns = int.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-simulateThreads":
+                    monteCarloThreads = int.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-simulateSeed":
+                    monteCarloSeed = ulong.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-tallChance":
+                    tallChance = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-coinChance":
+                    coinChance = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-speedPerCoin":
+                    speedPerCoin = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-botLateralSpeed":
+                    botLateralSpeed = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+                case "-botReaction":
+                    botReaction = float.Parse(value, CultureInfo.InvariantCulture);
+                    break;
+            }
+        }
+    }
+
+    IEnumerator Start()
+    {
+        //every frame advances game time by the same step, frames run as fast as the CPU allows
+        Time.captureDeltaTime = 1f / frameRate;
+        //go through the transition manager, the menu may already be preloading the game scene
+        if (SceneManager.GetActiveScene().buildIndex != gameScene)
+        {
+            SceneTransitionManager.Instance.Activate(gameScene);
+        }
+        while (SceneManager.GetActiveScene().buildIndex != gameScene)
+        {
+            yield return null;
+        }
+        //let the spawner lay the track before measuring
+        yield return null;
+        Application.targetFrameRate = -1;
+        QualitySettings.vSyncCount = 0;
+        player = Services.Get<SwerveMovement>();
+        spawner = Services.Get<GroundSpawner>();
+        floatingOrigin = Services.Get<FloatingOrigin>();
+        if (textBenchmarkUpdates > 0)
+        {
+            TextBenchmarkReport textReport = TextBenchmark.Run(textBenchmarkUpdates);
+            File.WriteAllText(reportPath, JsonUtility.ToJson(textReport, true));
+            UnityEngine.Debug.Log("SimulationHarness: text benchmark written to " + reportPath);
+            Application.Quit(0);
+            yield break;
+        }
+        if (monteCarloRuns > 0)
+        {
+            RunMonteCarlo();
+            yield break;
+        }
+        player.invulnerable = true;
+        if (motionBenchmark)
+        {
+            player.SetMotionMode(motionModes[0]);
+        }
+        player.MeasureMotion = measureMotion;
+        GameplayCounters.Reset();
+        gcRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Allocated In Frame");
+        //marker timings are only recorded in development players
+        physicsRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Physics, "Physics.Simulate");
+        startDistance = Distance();
+        if (pacerBenchmark)
+        {
+            pacer = new FramePacer(frameRate);
+            cpuStart = Process.GetCurrentProcess().TotalProcessorTime;
+        }
+        runStart = Stopwatch.GetTimestamp();
+        lastFrame = runStart;
+        running = true;
+    }
+
+    void Update()
+    {
+        if (!running)
+        {
+            return;
+        }
+        long now = Stopwatch.GetTimestamp();
+        frameMs.Add((now - lastFrame) * 1000.0 / Stopwatch.Frequency);
+        lastFrame = now;
+        if (gcRecorder.Valid)
+        {
+            gcBytes += gcRecorder.LastValue;
+        }
+        if (physicsRecorder.Valid)
+        {
+            physicsNs += physicsRecorder.LastValue;
+        }
+        maxLiveTiles = Mathf.Max(maxLiveTiles, spawner.LiveTiles);
+
+        float progress = (Distance() - startDistance) / (kilometres * 1000);
+        if (progress >= 1)
+        {
+            if (measureMotion)
+            {
+                motionRuns.Add(MotionRun());
+            }
+            if (motionBenchmark && ++motionMode < motionModes.Length)
+            {
+                NextMotionMode();
+                return;
+            }
+            Finish(true);
+            return;
+        }
+        if ((now - runStart) / (double)Stopwatch.Frequency > timeoutSeconds)
+        {
+            Finish(false);
+            return;
+        }
+        player.speed = SpeedAt(progress);
+        if (pacer != null)
+        {
+            pacer.Wait();
+        }
+    }
+
+    //same distance again from the start line in the next mode
+    void NextMotionMode()
+    {
+        player.SetMotionMode(motionModes[motionMode]);
+        GameManager.inst.RestartRun();
+        player.ResetMotionStats();
+        startDistance = Distance();
+    }
+
+    MotionRunReport MotionRun()
+    {
+        var run = new MotionRunReport();
+        run.motionMode = player.Motion.ToString();
+        run.steps = player.StepMs.Count;
+        run.stepMsMean = player.StepMs.Mean;
+        run.stepMsMax = player.StepMs.Max;
+        run.frames = player.FrameDisplacement.Count;
+        run.frameDisplacementMean = player.FrameDisplacement.Mean;
+        run.frameDisplacementVariance = player.FrameDisplacement.Variance;
+        var costs = new List<SpeedCostReport>();
+        RunningStat[] bySpeed = player.CostBySpeed;
+        for (int i = 0; i < bySpeed.Length; i++)
+        {
+            if (bySpeed[i].Count == 0)
+            {
+                continue;
+            }
+            var cost = new SpeedCostReport();
+            cost.speed = i * player.CostCurveBucket;
+            cost.steps = bySpeed[i].Count;
+            cost.meanMs = bySpeed[i].Mean;
+            cost.maxMs = bySpeed[i].Max;
+            costs.Add(cost);
+        }
+        run.costBySpeed = costs.ToArray();
+        return run;
+    }
+
+    //distance from the start line, unaffected by origin shifts
+    float Distance()
+    {
+        return player.transform.position.z + floatingOrigin.TotalOffset.z;
+    }
+
+    float SpeedAt(float progress)
+    {
+        if (speedProfile.Length == 1)
+        {
+            return speedProfile[0];
+        }
+        float position = Mathf.Clamp01(progress) * (speedProfile.Length - 1);
+        int index = Mathf.Min((int)position, speedProfile.Length - 2);
+        return Mathf.Lerp(speedProfile[index], speedProfile[index + 1], position - index);
+    }
+
+    //the scene is only loaded to read the prefab and player settings, nothing is played
+    void RunMonteCarlo()
+    {
+        GroundTile tilePrefab = spawner.TilePrefab.GetComponent<GroundTile>();
+        TrackSettings settings = tilePrefab.GetTrackSettings(spawner.CoinSlots.Count);
+        TrackLayout layout = tilePrefab.GetTrackLayout(spawner.CoinSlots);
+        RunRules rules = player.GetRunRules();
+        if (tallChance >= 0)
+        {
+            settings.tallObstacleChance = tallChance;
+        }
+        if (coinChance >= 0)
+        {
+            settings.coinChance = coinChance;
+        }
+        if (speedPerCoin >= 0)
+        {
+            rules.speedPerCoin = speedPerCoin;
+        }
+        rules.lateralSpeed = botLateralSpeed;
+        rules.reactionTime = botReaction;
+        rules.maxDistance = kilometres * 1000;
+
+        MonteCarloReport report = MonteCarlo.Run(settings, layout, rules, monteCarloRuns, monteCarloSeed, monteCarloThreads);
+        File.WriteAllText(reportPath, JsonUtility.ToJson(report, true));
+        UnityEngine.Debug.Log("SimulationHarness: " + report.runs + " runs at " + report.kmPerSecond.ToString("F0") + " km/s on " + report.threads + " threads, report written to " + reportPath);
+        Application.Quit(0);
+    }
+
+    void Finish(bool completed)
+    {
+        running = false;
+        var report = new SimulationReport();
+        report.completed = completed;
+        report.kilometres = kilometres;
+        report.speedProfile = speedProfile;
+        report.frameRate = frameRate;
+        report.frames = frameMs.Count;
+        report.simulatedSeconds = frameMs.Count / (double)frameRate;
+        report.wallSeconds = (Stopwatch.GetTimestamp() - runStart) / (double)Stopwatch.Frequency;
+        report.meanFrameMs = frameMs.Mean;
+        report.p50FrameMs = frameMs.P50;
+        report.p95FrameMs = frameMs.P95;
+        report.p99FrameMs = frameMs.P99;
+        report.maxFrameMs = frameMs.Max;
+        report.gcBytes = gcRecorder.Valid ? gcBytes : -1;
+        report.gcBytesPerTile = gcRecorder.Valid && GameplayCounters.TilesSpawned > 0 ? gcBytes / (double)GameplayCounters.TilesSpawned : -1;
+        report.tilesSpawned = GameplayCounters.TilesSpawned;
+        report.maxLiveTiles = maxLiveTiles;
+        report.instantiates = GameplayCounters.Instantiates;
+        report.destroys = GameplayCounters.Destroys;
+        report.triggerCallbacks = GameplayCounters.TriggerCallbacks;
+        report.collisionCallbacks = GameplayCounters.CollisionCallbacks;
+        report.coinsCollected = GameplayCounters.CoinsCollected;
+        report.originShifts = floatingOrigin.Shifts;
+        report.maxOriginShiftMs = floatingOrigin.MaxShiftMs;
+        report.physicsMsPerFrame = physicsRecorder.Valid && frameMs.Count > 0 ? physicsNs / 1e6 / frameMs.Count : -1;
+        LaneCollision lanes = spawner.LaneCollision;
+        report.analyticCollision = lanes != null;
+        report.laneStepMs = lanes != null ? lanes.StepMs.Mean : -1;
+        report.laneMsPerFrame = lanes != null && frameMs.Count > 0 ? lanes.StepMs.Mean * lanes.StepMs.Count / frameMs.Count : -1;
+        report.laneItemTests = lanes != null ? lanes.ItemTests : 0;
+        //a timed out run still reports the mode it got stuck in
+        if (measureMotion && motionRuns.Count <= motionMode)
+        {
+            motionRuns.Add(MotionRun());
+        }
+        report.motionRuns = motionRuns.ToArray();
+        report.pacerBenchmark = pacer != null;
+        if (pacer != null)
+        {
+            FrameIntervalHistogram intervals = pacer.Intervals;
+            report.pacerMeanMs = intervals.Mean;
+            report.pacerP50Ms = intervals.P50;
+            report.pacerP95Ms = intervals.P95;
+            report.pacerP99Ms = intervals.P99;
+            report.pacerMaxMs = intervals.Max;
+            report.pacerJitterMs = intervals.Jitter;
+            report.pacerMissedDeadlines = pacer.MissedDeadlines;
+            report.pacerSleepMs = pacer.SleepMs;
+            report.pacerSpinMs = pacer.SpinMs;
+            report.pacerSlackMs = pacer.SlackMs;
+            report.pacerBucketMs = FrameIntervalHistogram.BucketMs;
+            report.pacerIntervalBuckets = intervals.ToArray();
+            report.cpuSeconds = (Process.GetCurrentProcess().TotalProcessorTime - cpuStart).TotalSeconds;
+        }
+        gcRecorder.Dispose();
+        physicsRecorder.Dispose();
+
+        File.WriteAllText(reportPath, JsonUtility.ToJson(report, true));
+        UnityEngine.Debug.Log("SimulationHarness: " + (completed ? "finished" : "timed out") + ", report written to " + reportPath);
+        Application.Quit(completed ? 0 : 1);
+    }
+}
@@ -0,0 +1,91 @@
+using System;
+
+//what one headless run measured, written out with JsonUtility
+[Serializable]
+public class SimulationReport
+{
+    public bool completed;
+    public float kilometres;
+    public float[] speedProfile;
+    public int frameRate;
+    public int frames;
+    public double simulatedSeconds;
+    public double wallSeconds;
+
+    //wall time per frame, measured between harness updates
+    public double meanFrameMs;
+    public double p50FrameMs;
+    public double p95FrameMs;
+    public double p99FrameMs;
+    public double maxFrameMs;
+
+    //-1 when the player build does not expose the GC allocation counter
+    public long gcBytes;
+    public double gcBytesPerTile;
+
+    public int tilesSpawned;
+    public int maxLiveTiles;
+    public int instantiates;
+    public int destroys;
+    public int triggerCallbacks;
+    public int collisionCallbacks;
+    public int coinsCollected;
+    public int originShifts;
+    public double maxOriginShiftMs;
+
+    //PhysX step against the analytic lane tests, -1 where not measured
+    public bool analyticCollision;
+    public double physicsMsPerFrame;
+    public double laneStepMs;
+    public double laneMsPerFrame;
+    public int laneItemTests;
+
+    //-measureMotion or -motionBenchmark, one entry per motion mode played
+    public MotionRunReport[] motionRuns;
+
+    //-pacerBenchmark only: intervals between FramePacer.Wait returns and what the waits cost
+    public bool pacerBenchmark;
+    public double pacerMeanMs;
+    public double pacerP50Ms;
+    public double pacerP95Ms;
+    public double pacerP99Ms;
+    public double pacerMaxMs;
+    public double pacerJitterMs;
+    public int pacerMissedDeadlines;
+    //sleeping costs no CPU, spinning burns a core for its whole length
+    public double pacerSleepMs;
+    public double pacerSpinMs;
+    public double pacerSlackMs;
+    //interval histogram, bucket i counts intervals in [i, i + 1) * pacerBucketMs
+    public double pacerBucketMs;
+    public int[] pacerIntervalBuckets;
+    //process CPU time over the run, all threads
+    public double cpuSeconds;
+}
+
+//SwerveMovement's step cost and judder over one mode's share of the run
+[Serializable]
+public class MotionRunReport
+{
+    public string motionMode;
+    //FixedUpdate movement plus the Physics.SyncTransforms it makes necessary
+    public int steps;
+    public double stepMsMean;
+    public double stepMsMax;
+    //forward movement per frame over speed * deltaTime, 1 is perfectly even, variance is judder
+    public int frames;
+    public double frameDisplacementMean;
+    public double frameDisplacementVariance;
+    //step cost against speed, only buckets the run reached
+    public SpeedCostReport[] costBySpeed;
+}
+
+[Serializable]
+public class SpeedCostReport
+{
+    //lower edge of the bucket, speeds up to speed + SwerveMovement.CostCurveBucket
+    public float speed;
+    public int steps;
+    public double meanMs;
+    public double maxMs;
+}
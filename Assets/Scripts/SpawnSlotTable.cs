@@ -0,0 +1,93 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+//valid spawn positions inside a tile's collider, in tile local space
+//baked once per tile prefab so placement is an array lookup
+public class SpawnSlotTable
+{
+    static readonly Dictionary<GameObject, SpawnSlotTable> baked = new Dictionary<GameObject, SpawnSlotTable>();
+    readonly Vector3[] slots;
+
+    public int Count => slots.Length;
+    public Vector3 this[int index] => slots[index];
+
+    SpawnSlotTable(Vector3[] slots)
+    {
+        this.slots = slots;
+    }
+
+    public static SpawnSlotTable For(GameObject tilePrefab, int columns, int rows)
+    {
+        SpawnSlotTable table;
+        if (!baked.TryGetValue(tilePrefab, out table))
+        {
+            table = Bake(tilePrefab.GetComponent<Collider>(), columns, rows);
+            baked.Add(tilePrefab, table);
+        }
+        return table;
+    }
+
+    //lays a columns x rows grid over the footprint of the tile's root collider and keeps the cells inside it
+    static SpawnSlotTable Bake(Collider collider, int columns, int rows)
+    {
+        Bounds bounds = LocalBounds(collider);
+        var slots = new List<Vector3>(columns * rows);
+        for (int row = 0; row < rows; row++)
+        {
+            for (int column = 0; column < columns; column++)
+            {
+                Vector3 point = new Vector3
+                (
+                    Mathf.Lerp(bounds.min.x, bounds.max.x, (column + 0.5f) / columns),
+                    bounds.center.y,
+                    Mathf.Lerp(bounds.min.z, bounds.max.z, (row + 0.5f) / rows)
+                );
+                if (Contains(collider, point))
+                {
+                    slots.Add(point);
+                }
+            }
+        }
+        if (slots.Count == 0)
+        {
+            slots.Add(bounds.center);
+        }
+        return new SpawnSlotTable(slots.ToArray());
+    }
+
+    //works on prefab assets too, which have no world bounds yet
+    static Bounds LocalBounds(Collider collider)
+    {
+        switch (collider)
+        {
+            case BoxCollider box:
+                return new Bounds(box.center, box.size);
+            case SphereCollider sphere:
+                return new Bounds(sphere.center, Vector3.one * sphere.radius * 2);
+            case CapsuleCollider capsule:
+                Vector3 size = Vector3.one * capsule.radius * 2;
+                size[capsule.direction] = Mathf.Max(capsule.height, capsule.radius * 2);
+                return new Bounds(capsule.center, size);
+            case MeshCollider mesh when mesh.sharedMesh != null:
+                return mesh.sharedMesh.bounds;
+            default:
+                return new Bounds(Vector3.zero, Vector3.zero);
+        }
+    }
+
+    static bool Contains(Collider collider, Vector3 point)
+    {
+        switch (collider)
+        {
+            case SphereCollider sphere:
+                return (point - sphere.center).sqrMagnitude <= sphere.radius * sphere.radius;
+            case CapsuleCollider capsule:
+                Vector3 offset = point - capsule.center;
+                float half = Mathf.Max(0, capsule.height * 0.5f - capsule.radius);
+                offset[capsule.direction] = Mathf.Max(0, Mathf.Abs(offset[capsule.direction]) - half);
+                return offset.sqrMagnitude <= capsule.radius * capsule.radius;
+            default:
+                return true;
+        }
+    }
+}
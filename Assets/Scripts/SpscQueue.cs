@@ -0,0 +1,58 @@
+using System.Threading;
+
+//lock-free bounded queue for exactly one producer thread and one consumer thread
+public class SpscQueue<T>
+{
+    readonly T[] items;
+    readonly int mask;
+    long head;
+    long tail;
+
+    public SpscQueue(int capacity)
+    {
+        int size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        items = new T[size];
+        mask = size - 1;
+    }
+
+    public int Capacity => items.Length;
+    public int Count => (int)(Volatile.Read(ref tail) - Volatile.Read(ref head));
+
+    //producer only
+    public bool TryEnqueue(T item)
+    {
+        long t = tail;
+        if (t - Volatile.Read(ref head) >= items.Length)
+        {
+            return false;
+        }
+        items[t & mask] = item;
+        Volatile.Write(ref tail, t + 1);
+        return true;
+    }
+
+    //consumer only
+    public bool TryDequeue(out T item)
+    {
+        long h = head;
+        if (h >= Volatile.Read(ref tail))
+        {
+            item = default(T);
+            return false;
+        }
+        item = items[h & mask];
+        Volatile.Write(ref head, h + 1);
+        return true;
+    }
+
+    //only while neither side is running
+    public void Clear()
+    {
+        head = 0;
+        tail = 0;
+    }
+}
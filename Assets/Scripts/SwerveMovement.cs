@@ -1,11 +1,19 @@
 using System;
+using System.Diagnostics;
 using UnityEngine;
 using UnityEngine.SceneManagement;
 using UnityEngine.EventSystems;
 
-public class SwerveMovement : MonoBehaviour
+public class SwerveMovement : MonoBehaviour, IOriginShift
 {
-    
+    public enum MotionMode
+    {
+        //writes the transform directly, PhysX resyncs the body every step
+        Transform,
+        //kinematic body moved with MovePosition and rendered interpolated
+        KinematicRigidbody
+    }
+
     [SerializeField] private float maxDisplacement = 0.2f;
     [SerializeField] private float maxPositionX = 2f;
     [SerializeField] LayerMask groundMask;  
@@ -14,17 +22,204 @@ public class SwerveMovement : MonoBehaviour
     public float speed = 5; 
     bool alive = true;
     public float speedIncperpoint = 0.01f;
+    //reset the run in place instead of reloading the scene
+    [SerializeField] bool softRestart = true;
+    Vector3 startPosition;
+    Quaternion startRotation;
+    float startSpeed;
+    [SerializeField] MotionMode motionMode = MotionMode.KinematicRigidbody;
+    //body settings from the prefab, put back when switching to the transform mode
+    bool bodyKinematic;
+    RigidbodyInterpolation bodyInterpolation;
+    //lateral position the swerve input is steering towards, applied on the next physics step
+    float targetX;
+    //times Physics.SyncTransforms after each step so both modes can be compared
+    [SerializeField] bool measureMotion = false;
+    RunningStat stepMs;
+    RunningStat frameDisplacement;
+    float lastFrameZ;
+
+    [Header("High speed")]
+    //per-step travel beyond which the player switches to continuous collision and swept sub-steps
+    [SerializeField] float highSpeedStepTravel = 0.5f;
+    //longest distance covered by one swept sub-step
+    [SerializeField] float maxSubstepTravel = 0.5f;
+    [SerializeField] float costCurveBucket = 5f;
+    [SerializeField] CapsuleCollider capsule;
+    readonly RaycastHit[] sweepHits = new RaycastHit[8];
+    bool highSpeed;
+    //FixedUpdate movement cost by speed bucket, filled while measureMotion is on
+    RunningStat[] costBySpeed = new RunningStat[32];
+    FloatingOrigin floatingOrigin;
+    LaneCollision laneCollision;
+    TPPCameraController cameraRig;
+    //set by the simulation harness so a run can cover its whole distance
+    [NonSerialized] public bool invulnerable;
+
+    public MotionMode Motion => motionMode;
+    public bool MeasureMotion
+    {
+        get { return measureMotion; }
+        set
+        {
+            measureMotion = value;
+            lastFrameZ = transform.position.z;
+        }
+    }
+    public bool HighSpeed => highSpeed;
+    public int Substeps { get; private set; }
+    public RunningStat[] CostBySpeed => costBySpeed;
+    public float CostCurveBucket => costCurveBucket;
+    //cost of a physics step's movement plus the transform resync it causes
+    public RunningStat StepMs => stepMs;
+    //forward movement per rendered frame, relative to speed * deltaTime; variance is judder
+    public RunningStat FrameDisplacement => frameDisplacement;
+
+    private void Awake()
+    {
+        Services.Register(this);
+        startPosition = transform.localPosition;
+        startRotation = transform.localRotation;
+        startSpeed = speed;
+        targetX = startPosition.x;
+        bodyKinematic = rb.isKinematic;
+        bodyInterpolation = rb.interpolation;
+        ApplyMotionMode();
+        lastFrameZ = transform.position.z;
+        if (capsule == null)
+        {
+            capsule = GetComponent<CapsuleCollider>();
+        }
+    }
+
+    private void Start()
+    {
+        floatingOrigin = Services.Get<FloatingOrigin>();
+        floatingOrigin.Add(this);
+        GroundSpawner spawner = Services.Get<GroundSpawner>();
+        laneCollision = spawner.LaneCollision;
+        if (laneCollision == null)
+        {
+            return;
+        }
+        if (motionMode != MotionMode.KinematicRigidbody)
+        {
+            DisableLaneCollision();
+            return;
+        }
+        //no collider means no PhysX pairs or callbacks for the player at all
+        capsule.enabled = false;
+    }
+
+    //switches how the player is moved mid-game, the simulation harness runs each mode in turn
+    public void SetMotionMode(MotionMode mode)
+    {
+        motionMode = mode;
+        ApplyMotionMode();
+        targetX = transform.localPosition.x;
+        if (laneCollision != null && mode != MotionMode.KinematicRigidbody)
+        {
+            DisableLaneCollision();
+        }
+    }
+
+    void ApplyMotionMode()
+    {
+        if (motionMode == MotionMode.KinematicRigidbody)
+        {
+            //obstacles are triggers, so hits are still reported without kinematic contact pairs
+            rb.isKinematic = true;
+            rb.interpolation = RigidbodyInterpolation.Interpolate;
+            return;
+        }
+        rb.isKinematic = bodyKinematic;
+        rb.interpolation = bodyInterpolation;
+    }
+
+    void DisableLaneCollision()
+    {
+        UnityEngine.Debug.LogWarning("SwerveMovement: analytic collision needs the kinematic rigidbody motion mode, using PhysX");
+        Services.Get<GroundSpawner>().DisableLaneCollision();
+        laneCollision = null;
+        capsule.enabled = true;
+    }
+
+    public void ResetMotionStats()
+    {
+        stepMs.Clear();
+        frameDisplacement.Clear();
+        Array.Clear(costBySpeed, 0, costBySpeed.Length);
+        lastFrameZ = transform.position.z;
+    }
+
+    private void OnDestroy()
+    {
+        Services.Unregister(this);
+        if (floatingOrigin != null)
+        {
+            floatingOrigin.Remove(this);
+        }
+    }
+
+    //the player's side of the run model, steering is left to the caller
+    public RunRules GetRunRules()
+    {
+        RunRules rules = default;
+        rules.startSpeed = startSpeed;
+        rules.speedPerCoin = speedIncperpoint;
+        rules.maxPositionX = maxPositionX;
+        rules.playerRadius = capsule.radius * transform.lossyScale.x;
+        return rules;
+    }
+
+    //move body and transform together so interpolation does not smear the jump
+    public void ShiftOrigin(Vector3 offset)
+    {
+        rb.position += offset;
+        transform.position += offset;
+        lastFrameZ += offset.z;
+    }
 
     private void Update()
     {
         var inputX = GetInput();
         var displacementX = GetDisplacement(inputX);
+        if (motionMode == MotionMode.KinematicRigidbody)
+        {
+            targetX = Mathf.Clamp(targetX + displacementX, -maxPositionX, maxPositionX);
+            return;
+        }
         var newPosition = GetNewLocalPosition(displacementX);
         newPosition = GetLimitedLocalPosition(newPosition);
 
         transform.localPosition = newPosition;
     }
 
+    //the camera follows from here so it uses the position read for this frame and is never a frame behind
+    public void SetCamera(TPPCameraController rig)
+    {
+        cameraRig = rig;
+    }
+
+    private void LateUpdate()
+    {
+        Vector3 position = transform.position;
+        if (cameraRig != null)
+        {
+            cameraRig.Follow(position, Time.deltaTime);
+        }
+        if (!measureMotion)
+        {
+            return;
+        }
+        float z = position.z;
+        if (alive && Time.deltaTime > 0)
+        {
+            frameDisplacement.Add((z - lastFrameZ) / (speed * Time.deltaTime));
+        }
+        lastFrameZ = z;
+    }
+
     private Vector3 GetLimitedLocalPosition(Vector3 position)
     {
         position.x = Mathf.Clamp(position.x, -maxPositionX, maxPositionX);
@@ -67,19 +262,144 @@ public class SwerveMovement : MonoBehaviour
 
     void FixedUpdate()
     {
-        if (!alive) return;
-        transform.Translate(Vector3.forward * Time.fixedDeltaTime * speed);
+        long start = measureMotion ? Stopwatch.GetTimestamp() : 0;
+        if (motionMode == MotionMode.KinematicRigidbody)
+        {
+            Vector3 from = rb.position;
+            Vector3 position = from;
+            position.x = targetX;
+            if (alive)
+            {
+                position.z += Time.fixedDeltaTime * speed;
+            }
+            UpdateHighSpeed(Time.fixedDeltaTime * speed);
+            if (laneCollision != null && alive)
+            {
+                float radius = capsule.radius * transform.lossyScale.x;
+                position = laneCollision.Step(from, position, new Vector2(radius, radius), this);
+            }
+            else if (highSpeed && alive)
+            {
+                position = Sweep(from, position);
+            }
+            rb.MovePosition(position);
+        }
+        else
+        {
+            if (!alive) return;
+            transform.Translate(Vector3.forward * Time.fixedDeltaTime * speed);
+        }
+        if (measureMotion)
+        {
+            Physics.SyncTransforms();
+            double ms = (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+            stepMs.Add(ms);
+            int bucket = Mathf.Clamp((int)(speed / costCurveBucket), 0, costBySpeed.Length - 1);
+            costBySpeed[bucket].Add(ms);
+        }
+    }
+
+    void UpdateHighSpeed(float stepTravel)
+    {
+        bool wanted = stepTravel > highSpeedStepTravel;
+        if (wanted == highSpeed)
+        {
+            return;
+        }
+        highSpeed = wanted;
+        //speculative is the only continuous mode kinematic bodies support
+        rb.collisionDetectionMode = highSpeed ? CollisionDetectionMode.ContinuousSpeculative : CollisionDetectionMode.Discrete;
+        Substeps = 0;
+    }
+
+    //casts the player's capsule along the step in sub-steps of at most maxSubstepTravel
+    //coins passed through are collected, the first obstacle stops the player at the contact
+    Vector3 Sweep(Vector3 from, Vector3 to)
+    {
+        Vector3 step = to - from;
+        float distance = step.magnitude;
+        int substeps = Mathf.Max(1, Mathf.CeilToInt(distance / maxSubstepTravel));
+        Substeps = substeps;
+        Vector3 direction = step / distance;
+        float length = distance / substeps;
+        float scale = transform.lossyScale.y;
+        float radius = capsule.radius * scale;
+        Vector3 axis = Vector3.up * Mathf.Max(0, capsule.height * 0.5f * scale - radius);
+        Vector3 center = capsule.center * scale;
+        int mask = (1 << EntityLayers.Obstacle) | (1 << EntityLayers.Coin);
+        for (int s = 0; s < substeps; s++)
+        {
+            Vector3 origin = from + center + direction * (length * s);
+            int count = Physics.CapsuleCastNonAlloc(origin + axis, origin - axis, radius, direction, sweepHits, length, mask, QueryTriggerInteraction.Collide);
+            float obstacleDistance = float.MaxValue;
+            for (int i = 0; i < count; i++)
+            {
+                RaycastHit hit = sweepHits[i];
+                if (hit.collider.gameObject.layer == EntityLayers.Obstacle && !invulnerable)
+                {
+                    obstacleDistance = Mathf.Min(obstacleDistance, hit.distance);
+                }
+            }
+            for (int i = 0; i < count; i++)
+            {
+                RaycastHit hit = sweepHits[i];
+                Coin coin;
+                if (hit.collider.gameObject.layer == EntityLayers.Coin && hit.distance <= obstacleDistance && hit.collider.TryGetComponent(out coin))
+                {
+                    coin.Collect();
+                }
+            }
+            if (obstacleDistance < float.MaxValue)
+            {
+                Die();
+                return from + direction * (length * s + Mathf.Max(0, obstacleDistance - Physics.defaultContactOffset));
+            }
+        }
+        return to;
     }
     
     public void Die()
     {
+        //the sweep and the contact it anticipated can both report the same hit
+        if (!alive || invulnerable)
+        {
+            return;
+        }
         //Restart the game
         alive = false;
+        GameManager.inst.EndRun();
         Invoke("Restart" , 2);
     }
 
     void Restart()
     {
+        if (softRestart)
+        {
+            GameManager.inst.RestartRun();
+            return;
+        }
         SceneManager.LoadScene(SceneManager.GetActiveScene().name); //restarting game
     }
+
+    //back to the start line at the starting speed
+    public void ResetRun()
+    {
+        CancelInvoke("Restart");
+        alive = true;
+        speed = startSpeed;
+        transform.localPosition = startPosition;
+        transform.localRotation = startRotation;
+        rb.position = transform.position;
+        rb.rotation = transform.rotation;
+        rb.velocity = Vector3.zero;
+        rb.angularVelocity = Vector3.zero;
+        _anchorPosition = Vector2.zero;
+        targetX = startPosition.x;
+        lastFrameZ = rb.position.z;
+        if (cameraRig != null)
+        {
+            cameraRig.Snap(rb.position);
+        }
+        UpdateHighSpeed(Time.fixedDeltaTime * speed);
+    }
 }
\ No newline at end of file
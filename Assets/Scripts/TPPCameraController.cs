@@ -2,19 +2,84 @@ using System.Collections;
 using System.Collections.Generic;
 using UnityEngine;
 
-public class TPPCameraController : MonoBehaviour
+public class TPPCameraController : MonoBehaviour, IOriginShift
 {
     public GameObject player;
     private Vector3 offset;
+    //critically damped spring on the sideways and vertical follow, forward always tracks exactly
+    [SerializeField] bool smooth = false;
+    [SerializeField] float smoothTime = 0.1f;
+    Transform target;
+    Transform cachedTransform;
+    //last position written, so following never reads the camera transform back
+    Vector3 position;
+    Vector3 velocity;
+    //true when the player's LateUpdate drives the camera with the position it already read
+    bool driven;
+    FloatingOrigin floatingOrigin;
     // Start is called before the first frame update
     void Start()
     {
-        offset = transform.position - player.transform.position;
+        target = player.transform;
+        cachedTransform = transform;
+        position = cachedTransform.position;
+        offset = position - target.position;
+        SwerveMovement movement = player.GetComponent<SwerveMovement>();
+        if (movement != null)
+        {
+            movement.SetCamera(this);
+            driven = true;
+        }
+        floatingOrigin = Services.Get<FloatingOrigin>();
+        floatingOrigin.Add(this);
     }
 
-    // Update is called once per frame
-    void Update()
+    void OnDestroy()
     {
-        transform.position = player.transform.position + offset;
+        if (floatingOrigin != null)
+        {
+            floatingOrigin.Remove(this);
+        }
+    }
+
+    //runs after every Update, so the player has already moved this frame
+    void LateUpdate()
+    {
+        if (!driven)
+        {
+            Follow(target.position, Time.deltaTime);
+        }
+    }
+
+    public void Follow(Vector3 playerPosition, float deltaTime)
+    {
+        Vector3 wanted = playerPosition + offset;
+        if (smooth && deltaTime > 0)
+        {
+            //closed form step of a critically damped spring, stable at any frame time
+            float omega = 2f / smoothTime;
+            float decay = Mathf.Exp(-omega * deltaTime);
+            Vector3 error = position - wanted;
+            error.z = 0;
+            Vector3 temp = (velocity + omega * error) * deltaTime;
+            velocity = (velocity - omega * temp) * decay;
+            wanted += (error + temp) * decay;
+        }
+        position = wanted;
+        cachedTransform.position = position;
+    }
+
+    //jump straight to the player, used on restart
+    public void Snap(Vector3 playerPosition)
+    {
+        velocity = Vector3.zero;
+        position = playerPosition + offset;
+        cachedTransform.position = position;
+    }
+
+    public void ShiftOrigin(Vector3 shift)
+    {
+        position += shift;
+        cachedTransform.position = position;
     }
 }
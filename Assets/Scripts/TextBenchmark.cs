@@ -0,0 +1,205 @@
+using System.Collections.Generic;
+using System.Diagnostics;
+using TMPro;
+using UnityEngine;
+
+//times a ticking "Score : n" counter through a full TMP rebuild and through IncrementalText,
+//character lookups through the font dictionary and through FontGlyphTable,
+//kerning lookups through a dictionary and through KerningTable,
+//and repeated coloured banners through TMP's tag parser and through CompiledRichText
+public static class TextBenchmark
+{
+    public static TextBenchmarkReport Run(int updates)
+    {
+        var canvas = new GameObject("TextBenchmark", typeof(Canvas));
+        var label = new GameObject("Counter", typeof(RectTransform));
+        label.transform.SetParent(canvas.transform, false);
+        TextMeshProUGUI text = label.AddComponent<TextMeshProUGUI>();
+        text.enableWordWrapping = false;
+        text.richText = false;
+        IncrementalText incremental = label.AddComponent<IncrementalText>();
+        var labels = new NumberLabel("Score : ", updates);
+
+        var report = new TextBenchmarkReport();
+        report.updates = updates;
+        report.font = text.font != null ? text.font.name : "";
+
+        text.SetText(labels.Get(0));
+        text.ForceMeshUpdate();
+        long start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < updates; i++)
+        {
+            text.SetText(labels.Get(i));
+            text.ForceMeshUpdate();
+        }
+        report.fullMsPerUpdate = ElapsedMs(start) / updates;
+
+        incremental.SetText(labels.Get(0));
+        text.ForceMeshUpdate();
+        start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < updates; i++)
+        {
+            incremental.SetText(labels.Get(i));
+            //a fallback only marks the text dirty, pay for its rebuild here like the canvas would
+            if (text.havePropertiesChanged)
+            {
+                text.ForceMeshUpdate();
+            }
+        }
+        report.incrementalMsPerUpdate = ElapsedMs(start) / updates;
+        report.patched = incremental.Patched;
+        report.rebuilt = incremental.Rebuilt;
+
+        MeasureRichText(canvas.transform, updates, report);
+
+        if (text.font != null)
+        {
+            MeasureLookups(text.font, updates * 100, report);
+            MeasureKerning(text.font, updates * 100, report);
+        }
+
+        Object.Destroy(canvas);
+        return report;
+    }
+
+    static void MeasureRichText(Transform canvas, int updates, TextBenchmarkReport report)
+    {
+        var label = new GameObject("Banner", typeof(RectTransform));
+        label.transform.SetParent(canvas, false);
+        TextMeshProUGUI text = label.AddComponent<TextMeshProUGUI>();
+        text.enableWordWrapping = false;
+        CompiledRichText compiled = label.AddComponent<CompiledRichText>();
+        var banners = new string[8];
+        for (int i = 0; i < banners.Length; i++)
+        {
+            banners[i] = "<color=#FFD700>New best!</color> <color=#FFFFFF>" + (i * 125) + "</color> <color=orange>m</color>";
+        }
+
+        text.richText = true;
+        long start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < updates; i++)
+        {
+            text.SetText(banners[i % banners.Length]);
+            text.ForceMeshUpdate();
+        }
+        report.richMsPerUpdate = ElapsedMs(start) / updates;
+
+        int hits = RichTextCache.Hits;
+        int misses = RichTextCache.Misses;
+        start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < updates; i++)
+        {
+            compiled.SetText(banners[i % banners.Length]);
+            if (text.havePropertiesChanged)
+            {
+                text.ForceMeshUpdate();
+            }
+        }
+        report.compiledMsPerUpdate = ElapsedMs(start) / updates;
+        hits = RichTextCache.Hits - hits;
+        misses = RichTextCache.Misses - misses;
+        report.richCacheHitRate = hits + misses == 0 ? 0 : hits / (float)(hits + misses);
+        report.richCacheBytes = RichTextCache.Bytes;
+    }
+
+    static void MeasureLookups(TMP_FontAsset font, int lookups, TextBenchmarkReport report)
+    {
+        var sample = new uint[224];
+        for (int i = 0; i < sample.Length; i++)
+        {
+            sample[i] = (uint)(i < 95 ? 32 + i : 160 + i - 95);
+        }
+        Dictionary<uint, TMP_Character> dictionary = font.characterLookupTable;
+        FontGlyphTable table = FontGlyphTable.For(font);
+        TMP_Character character;
+        int found = 0;
+        table.TryGet(32, out character);
+
+        long start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < lookups; i++)
+        {
+            if (dictionary.TryGetValue(sample[i % sample.Length], out character))
+            {
+                found++;
+            }
+        }
+        report.dictionaryLookupNs = ElapsedMs(start) * 1e6 / lookups;
+
+        start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < lookups; i++)
+        {
+            if (table.TryGet(sample[i % sample.Length], out character))
+            {
+                found--;
+            }
+        }
+        report.flatLookupNs = ElapsedMs(start) * 1e6 / lookups;
+        //both paths must agree on what the font contains
+        UnityEngine.Debug.Assert(found == 0, "TextBenchmark: FontGlyphTable disagrees with characterLookupTable");
+    }
+
+    static void MeasureKerning(TMP_FontAsset font, int lookups, TextBenchmarkReport report)
+    {
+        List<TMP_GlyphPairAdjustmentRecord> records = font.fontFeatureTable.glyphPairAdjustmentRecords;
+        report.kerningPairs = records.Count;
+        if (records.Count == 0)
+        {
+            return;
+        }
+        //same key packing TMP uses for its own lookup
+        var dictionary = new Dictionary<uint, TMP_GlyphPairAdjustmentRecord>(records.Count);
+        var firsts = new uint[records.Count * 2];
+        var seconds = new uint[records.Count * 2];
+        for (int i = 0; i < records.Count; i++)
+        {
+            uint first = records[i].firstAdjustmentRecord.glyphIndex;
+            uint second = records[i].secondAdjustmentRecord.glyphIndex;
+            //TMP only adds a pair it does not have yet, so the first record for it wins
+            uint key = second << 16 | first;
+            if (!dictionary.ContainsKey(key))
+            {
+                dictionary.Add(key, records[i]);
+            }
+            firsts[i * 2] = first;
+            seconds[i * 2] = second;
+            //swapped pairs are mostly not kerned
+            firsts[i * 2 + 1] = second;
+            seconds[i * 2 + 1] = first;
+        }
+        KerningTable table = KerningTable.For(font);
+        KerningTable.Adjustment adjustment;
+        table.TryGet(0, 0, out adjustment);
+
+        int found = 0;
+        TMP_GlyphPairAdjustmentRecord record;
+        long start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < lookups; i++)
+        {
+            int pair = i % firsts.Length;
+            if (dictionary.TryGetValue(seconds[pair] << 16 | firsts[pair], out record))
+            {
+                found++;
+            }
+        }
+        report.dictionaryKerningNs = ElapsedMs(start) * 1e6 / lookups;
+
+        start = Stopwatch.GetTimestamp();
+        for (int i = 0; i < lookups; i++)
+        {
+            int pair = i % firsts.Length;
+            if (table.TryGet(firsts[pair], seconds[pair], out adjustment))
+            {
+                found--;
+            }
+        }
+        report.flatKerningNs = ElapsedMs(start) * 1e6 / lookups;
+        report.dictionaryKerningBytes = (long)dictionary.Count * (24 + 4);
+        report.flatKerningBytes = table.Bytes;
+        UnityEngine.Debug.Assert(found == 0, "TextBenchmark: KerningTable disagrees with the pair dictionary");
+    }
+
+    static double ElapsedMs(long start)
+    {
+        return (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+    }
+}
@@ -0,0 +1,33 @@
+using System;
+
+//cost per counter update of each text path, written out with JsonUtility
+[Serializable]
+public class TextBenchmarkReport
+{
+    public int updates;
+    public string font;
+    //SetText followed by the full TMP rebuild
+    public double fullMsPerUpdate;
+    //IncrementalText, including the rebuilds it falls back to
+    public double incrementalMsPerUpdate;
+    public int patched;
+    public int rebuilt;
+
+    //one character lookup over a Latin-1 sample, through characterLookupTable and through FontGlyphTable
+    public double dictionaryLookupNs;
+    public double flatLookupNs;
+
+    //glyph pair adjustment lookups, half of them misses, through a dictionary keyed like TMP's and through KerningTable
+    public int kerningPairs;
+    public double dictionaryKerningNs;
+    public double flatKerningNs;
+    //entries and buckets of the dictionary, estimated; the records themselves are shared with the font
+    public long dictionaryKerningBytes;
+    public long flatKerningBytes;
+
+    //a handful of coloured banners shown in turn, through TMP's tag parser and through CompiledRichText
+    public double richMsPerUpdate;
+    public double compiledMsPerUpdate;
+    public float richCacheHitRate;
+    public int richCacheBytes;
+}
@@ -0,0 +1,147 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using UnityEngine;
+
+//fixed-capacity ring buffer of ground tiles
+//tiles are handed out in spawn order and the oldest released tile is recycled in place
+public class TilePool
+{
+    readonly GameObject prefab;
+    readonly GroundTile[] tiles;
+    readonly float[] releaseTimes;
+    readonly float recycleDelay;
+    //tiles created while the ring was busy, destroyed by themselves once passed
+    readonly List<GroundTile> overflow = new List<GroundTile>();
+    static readonly Predicate<GroundTile> isDestroyed = tile => tile == null;
+    int head;
+    int count;
+
+    public int Capacity => tiles.Length;
+    public int Count => count;
+    public int Hits { get; private set; }
+    public int Misses { get; private set; }
+    public double LastRecycleMs { get; private set; }
+    public double MaxRecycleMs { get; private set; }
+    public double TotalRecycleMs { get; private set; }
+    public double AverageRecycleMs => Hits == 0 ? 0 : TotalRecycleMs / Hits;
+
+    public TilePool(GameObject prefab, int capacity, float recycleDelay)
+    {
+        this.prefab = prefab;
+        this.recycleDelay = recycleDelay;
+        tiles = new GroundTile[capacity];
+        releaseTimes = new float[capacity];
+    }
+
+    public GroundTile Spawn(Vector3 position)
+    {
+        GroundTile tile;
+        //oldest tile has been passed and is out of sight
+        if (count > 0 && Time.time >= releaseTimes[head] + recycleDelay)
+        {
+            long start = Stopwatch.GetTimestamp();
+            tile = tiles[head];
+            tile.Recycle(position);
+            tiles[head] = null;
+            head = (head + 1) % tiles.Length;
+            count--;
+            Append(tile);
+            RecordRecycle(Stopwatch.GetTimestamp() - start);
+            return tile;
+        }
+
+        Misses++;
+        //still filling the ring
+        if (count < tiles.Length)
+        {
+            tile = CreateTile(position, true);
+            Append(tile);
+            return tile;
+        }
+
+        //every slot is in use or lingering behind the player
+        tile = CreateTile(position, false);
+        overflow.RemoveAll(isDestroyed);
+        overflow.Add(tile);
+        return tile;
+    }
+
+    //hand every tile back at once, the next spawns reuse them oldest first
+    public void ReleaseAll()
+    {
+        for (int i = 0; i < count; i++)
+        {
+            int slot = (head + i) % tiles.Length;
+            tiles[slot].Park();
+            releaseTimes[slot] = float.NegativeInfinity;
+        }
+        for (int i = 0; i < overflow.Count; i++)
+        {
+            if (overflow[i] != null)
+            {
+                GameplayCounters.Destroys++;
+                UnityEngine.Object.Destroy(overflow[i].gameObject);
+            }
+        }
+        overflow.Clear();
+    }
+
+    //move every tile, lingering overflow included, when the world origin is shifted
+    public void Shift(Vector3 offset)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            tiles[(head + i) % tiles.Length].ShiftOrigin(offset);
+        }
+        for (int i = 0; i < overflow.Count; i++)
+        {
+            if (overflow[i] != null)
+            {
+                overflow[i].ShiftOrigin(offset);
+            }
+        }
+    }
+
+    void Append(GroundTile tile)
+    {
+        int slot = (head + count) % tiles.Length;
+        tiles[slot] = tile;
+        releaseTimes[slot] = float.MaxValue;
+        count++;
+    }
+
+    public void Release(GroundTile tile)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            int slot = (head + i) % tiles.Length;
+            if (tiles[slot] == tile)
+            {
+                releaseTimes[slot] = Time.time;
+                return;
+            }
+        }
+    }
+
+    GroundTile CreateTile(Vector3 position, bool pooled)
+    {
+        GameplayCounters.Instantiates++;
+        GameObject temp = UnityEngine.Object.Instantiate(prefab, position, Quaternion.identity);
+        GroundTile tile = temp.GetComponent<GroundTile>();
+        tile.pooled = pooled;
+        return tile;
+    }
+
+    void RecordRecycle(long ticks)
+    {
+        double ms = ticks * 1000.0 / Stopwatch.Frequency;
+        Hits++;
+        LastRecycleMs = ms;
+        TotalRecycleMs += ms;
+        if (ms > MaxRecycleMs)
+        {
+            MaxRecycleMs = ms;
+        }
+    }
+}
@@ -0,0 +1,35 @@
+//everything random about one ground tile, decided ahead of time by TrackGenerator
+public struct TrackChunk
+{
+    public const int CoinCount = 2;
+
+    public byte firstObstacleLane;
+    public byte secondObstacleLane;
+    //tallObstacleChance roll, the first anchor gets the tall obstacle instead of the regular one
+    public bool tallRoll;
+    public ushort coinSlot0;
+    public ushort coinSlot1;
+    //bit i set when coin i is placed, see TrackSettings.coinChance
+    public byte coinMask;
+
+    public int CoinSlot(int index)
+    {
+        return index == 0 ? coinSlot0 : coinSlot1;
+    }
+
+    public bool HasCoin(int index)
+    {
+        return (coinMask & (1 << index)) != 0;
+    }
+}
+
+//inputs the generator needs from the tile prefab
+public struct TrackSettings
+{
+    public float tallObstacleChance;
+    public int firstObstacleLanes;
+    public int secondObstacleLanes;
+    public int coinSlots;
+    //chance of each coin being placed, at 1 no extra draws are made so seeds keep their old layouts
+    public float coinChance;
+}
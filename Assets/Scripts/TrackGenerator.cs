@@ -0,0 +1,102 @@
+using System.Threading;
+
+//generates tile content from a seed on a worker thread, a fixed number of tiles ahead of the spawner
+//the same seed always produces the same sequence of chunks
+public class TrackGenerator
+{
+    readonly TrackSettings settings;
+    readonly SpscQueue<TrackChunk> queue;
+    readonly AutoResetEvent wake = new AutoResetEvent(false);
+    Thread worker;
+    volatile bool running;
+    TrackRandom random;
+
+    public ulong Seed { get; private set; }
+    public int Buffered => queue.Count;
+    //times the main thread found the queue empty and had to wait
+    public int Stalls { get; private set; }
+
+    public TrackGenerator(TrackSettings settings, int lookahead)
+    {
+        this.settings = settings;
+        queue = new SpscQueue<TrackChunk>(lookahead);
+    }
+
+    public void Start(ulong seed)
+    {
+        Stop();
+        Seed = seed;
+        random = new TrackRandom(seed);
+        queue.Clear();
+        running = true;
+        worker = new Thread(Run);
+        worker.IsBackground = true;
+        worker.Name = "TrackGenerator";
+        worker.Start();
+    }
+
+    public void Stop()
+    {
+        if (worker == null)
+        {
+            return;
+        }
+        running = false;
+        wake.Set();
+        worker.Join();
+        worker = null;
+    }
+
+    //main thread only
+    public TrackChunk Next()
+    {
+        TrackChunk chunk;
+        if (!queue.TryDequeue(out chunk))
+        {
+            Stalls++;
+            var spin = new SpinWait();
+            while (!queue.TryDequeue(out chunk))
+            {
+                wake.Set();
+                spin.SpinOnce();
+            }
+        }
+        wake.Set();
+        return chunk;
+    }
+
+    void Run()
+    {
+        while (running)
+        {
+            while (running && queue.Count < queue.Capacity)
+            {
+                queue.TryEnqueue(Generate(ref random, settings));
+            }
+            wake.WaitOne();
+        }
+    }
+
+    //same draw order as the old inline Random.Range calls in GroundTile
+    public static TrackChunk Generate(ref TrackRandom random, TrackSettings settings)
+    {
+        TrackChunk chunk;
+        chunk.tallRoll = random.NextFloat() < settings.tallObstacleChance;
+        chunk.firstObstacleLane = (byte)random.Range(0, settings.firstObstacleLanes);
+        chunk.secondObstacleLane = (byte)random.Range(0, settings.secondObstacleLanes);
+        chunk.coinSlot0 = (ushort)random.Range(0, settings.coinSlots);
+        chunk.coinSlot1 = (ushort)random.Range(0, settings.coinSlots);
+        chunk.coinMask = (1 << TrackChunk.CoinCount) - 1;
+        if (settings.coinChance < 1)
+        {
+            for (int i = 0; i < TrackChunk.CoinCount; i++)
+            {
+                if (random.NextFloat() >= settings.coinChance)
+                {
+                    chunk.coinMask &= (byte)~(1 << i);
+                }
+            }
+        }
+        return chunk;
+    }
+}
@@ -0,0 +1,17 @@
+using UnityEngine;
+
+//tile geometry the run model needs, in tile-local x/z
+//copied out of the prefab so worker threads never touch Unity objects
+public struct TrackLayout
+{
+    public float length;
+    public Vector2[] firstObstacle;
+    public Vector2[] secondObstacle;
+    //half extents of the obstacles placed at each anchor
+    public Vector2 firstFootprint;
+    //the tall obstacle takes the first anchor when TrackChunk.tallRoll is set
+    public Vector2 tallFootprint;
+    public Vector2 secondFootprint;
+    public Vector2[] coinSlots;
+    public float coinRadius;
+}
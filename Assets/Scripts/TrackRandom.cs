@@ -0,0 +1,47 @@
+//small deterministic generator for track content, identical on every platform
+//xorshift128+ seeded through splitmix64
+public struct TrackRandom
+{
+    ulong s0;
+    ulong s1;
+
+    public TrackRandom(ulong seed)
+    {
+        s0 = SplitMix(ref seed);
+        s1 = SplitMix(ref seed);
+    }
+
+    public ulong NextULong()
+    {
+        ulong x = s0;
+        ulong y = s1;
+        s0 = y;
+        x ^= x << 23;
+        s1 = x ^ y ^ (x >> 17) ^ (y >> 26);
+        return s1 + y;
+    }
+
+    //[0, 1)
+    public float NextFloat()
+    {
+        return (NextULong() >> 40) * (1f / (1 << 24));
+    }
+
+    //[min, max) like UnityEngine.Random.Range for ints
+    public int Range(int min, int max)
+    {
+        if (max <= min)
+        {
+            return min;
+        }
+        return min + (int)((NextULong() >> 33) % (ulong)(max - min));
+    }
+
+    static ulong SplitMix(ref ulong state)
+    {
+        ulong z = state += 0x9E3779B97F4A7C15UL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+        return z ^ (z >> 31);
+    }
+}